@@ -0,0 +1,39 @@
+#include "Algorithm/Tree/Trees.h"
+#include "Deamer/Algorithm/Tree/BFS.h"
+
+using deamer::algorithm::benchmarks::Node;
+using deamer::algorithm::benchmarks::Run;
+using deamer::algorithm::benchmarks::Shape;
+using deamer::algorithm::tree::BFS;
+
+static void BFS_Search(benchmark::State& state, Shape shape)
+{
+	Run(state, shape, [](Node* root) {
+		benchmark::DoNotOptimize(BFS::Search(root, &Node::GetSubNodes));
+	});
+}
+
+static void BFS_SearchPrefetch(benchmark::State& state, Shape shape)
+{
+	Run(state, shape, [](Node* root) {
+		benchmark::DoNotOptimize(BFS::Search(
+			root, &Node::GetSubNodes,
+			deamer::algorithm::tree::Prefetch(8, [](Node* node) {
+				return node->subNodes.data();
+			})));
+	});
+}
+
+static void BFS_Execute(benchmark::State& state, Shape shape)
+{
+	Run(state, shape, [](Node* root) {
+		std::size_t count = 0;
+		BFS::Execute::Search(
+			root, &Node::GetSubNodes, [&](Node*) { count++; }, [&](Node*) { count++; });
+		benchmark::DoNotOptimize(count);
+	});
+}
+
+DEAMER_ALGORITHM_BENCHMARK_SHAPES(BFS_Search, 10000000, 10000000);
+DEAMER_ALGORITHM_BENCHMARK_SHAPES(BFS_SearchPrefetch, 10000000, 10000000);
+DEAMER_ALGORITHM_BENCHMARK_SHAPES(BFS_Execute, 10000000, 10000000);
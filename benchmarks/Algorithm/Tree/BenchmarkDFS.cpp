@@ -0,0 +1,189 @@
+#include "Algorithm/Tree/Trees.h"
+#include "Deamer/Algorithm/Tree/DFS.h"
+#include <map>
+#include <memory_resource>
+#include <numeric>
+
+using deamer::algorithm::benchmarks::Node;
+using deamer::algorithm::benchmarks::Run;
+using deamer::algorithm::benchmarks::Shape;
+using deamer::algorithm::tree::DFS;
+
+namespace
+{
+	struct Counter
+	{
+		std::size_t count = 0;
+
+		void Entry(Node*)
+		{
+			count++;
+		}
+
+		void Exit(Node*)
+		{
+			count++;
+		}
+	};
+}
+
+static void DFS_Heap_Search(benchmark::State& state, Shape shape)
+{
+	Run(state, shape, [](Node* root) {
+		benchmark::DoNotOptimize(DFS::Heap::Search(root, &Node::GetSubNodes));
+	});
+}
+
+// The arena keeps its memory between iterations, thus only the first iteration allocates.
+static void DFS_Heap_SearchArena(benchmark::State& state, Shape shape)
+{
+	std::pmr::unsynchronized_pool_resource arena;
+	Run(state, shape, [&arena](Node* root) {
+		benchmark::DoNotOptimize(
+			DFS::Heap::Search(std::allocator_arg, &arena, root, &Node::SubNodes));
+	});
+}
+
+static void DFS_Context_Search(benchmark::State& state, Shape shape)
+{
+	DFS::Context<Node> context;
+	Run(state, shape, [&context](Node* root) {
+		benchmark::DoNotOptimize(context.Search(root, &Node::SubNodes).data());
+	});
+}
+
+static void DFS_Heap_SearchPrefetch(benchmark::State& state, Shape shape)
+{
+	Run(state, shape, [](Node* root) {
+		benchmark::DoNotOptimize(DFS::Heap::Search(
+			root, &Node::GetSubNodes,
+			deamer::algorithm::tree::Prefetch(8, [](Node* node) {
+				return node->subNodes.data();
+			})));
+	});
+}
+
+static void DFS_Heap_SearchCounted(benchmark::State& state, Shape shape)
+{
+	Run(state, shape, [](Node* root) {
+		benchmark::DoNotOptimize(DFS::Heap::Search(
+			root, &Node::GetSubNodes, deamer::algorithm::tree::SizeHint::Count()));
+	});
+}
+
+static void DFS_Heap_SearchPacked(benchmark::State& state, Shape shape)
+{
+	Run(state, shape, [](Node* root) {
+		benchmark::DoNotOptimize(DFS::Heap::SearchPacked(root, &Node::GetSubNodes));
+	});
+}
+
+static void DFS_Heap_SearchParent(benchmark::State& state, Shape shape)
+{
+	Run(state, shape, [](Node* root) {
+		benchmark::DoNotOptimize(DFS::Heap::Search(root, &Node::GetParent, &Node::GetSubNodes));
+	});
+}
+
+static void DFS_Stack_Search(benchmark::State& state, Shape shape)
+{
+	Run(state, shape, [](Node* root) {
+		benchmark::DoNotOptimize(DFS::Stack::Search(root, &Node::GetSubNodes));
+	});
+}
+
+static void DFS_Execute_Heap(benchmark::State& state, Shape shape)
+{
+	Run(state, shape, [](Node* root) {
+		Counter counter;
+		DFS::Execute::Heap::Search(root, &Node::GetSubNodes, &Counter::Entry, &Counter::Exit,
+								   &counter);
+		benchmark::DoNotOptimize(counter.count);
+	});
+}
+
+static void DFS_Execute_HeapParent(benchmark::State& state, Shape shape)
+{
+	Run(state, shape, [](Node* root) {
+		Counter counter;
+		DFS::Execute::Heap::Search(root, &Node::GetParent, &Node::GetSubNodes, &Counter::Entry,
+								   &Counter::Exit, &counter);
+		benchmark::DoNotOptimize(counter.count);
+	});
+}
+
+static void DFS_Execute_Streaming(benchmark::State& state, Shape shape)
+{
+	Run(state, shape, [](Node* root) {
+		std::size_t count = 0;
+		DFS::Execute::Streaming::Search(
+			root, &Node::GetSubNodes, [&](Node*) { count++; }, [&](Node*) { count++; });
+		benchmark::DoNotOptimize(count);
+	});
+}
+
+static void DFS_Execute_StreamingReference(benchmark::State& state, Shape shape)
+{
+	Run(state, shape, [](Node* root) {
+		std::size_t count = 0;
+		DFS::Execute::Streaming::Search(
+			root, &Node::SubNodes, [&](Node*) { count++; }, [&](Node*) { count++; });
+		benchmark::DoNotOptimize(count);
+	});
+}
+
+static void DFS_Execute_Stack(benchmark::State& state, Shape shape)
+{
+	Run(state, shape, [](Node* root) {
+		std::size_t count = 0;
+		DFS::Execute::Stack::Search(
+			root, &Node::GetSubNodes, [&](Node*) { count++; }, [&](Node*) { count++; });
+		benchmark::DoNotOptimize(count);
+	});
+}
+
+static void DFS_Fold_SubtreeSize(benchmark::State& state, Shape shape)
+{
+	Run(state, shape, [](Node* root) {
+		benchmark::DoNotOptimize(DFS::Fold(
+			root, &Node::SubNodes, [](Node*) { return std::size_t(1); },
+			[](Node*, auto first, auto last) {
+				return std::accumulate(first, last, std::size_t(1));
+			}));
+	});
+}
+
+// Fold emulated by storing the value of every subtree in a map.
+static void DFS_Fold_SubtreeSizeMap(benchmark::State& state, Shape shape)
+{
+	Run(state, shape, [](Node* root) {
+		std::map<Node*, std::size_t> sizes;
+		DFS::Execute::Streaming::Search(
+			root, &Node::SubNodes, [](Node*) {},
+			[&sizes](Node* node) {
+				std::size_t size = 1;
+				for (auto subnode : node->SubNodes())
+				{
+					size += sizes[subnode];
+				}
+				sizes[node] = size;
+			});
+		benchmark::DoNotOptimize(sizes[root]);
+	});
+}
+
+DEAMER_ALGORITHM_BENCHMARK_SHAPES(DFS_Heap_Search, 10000000, 10000000);
+DEAMER_ALGORITHM_BENCHMARK_SHAPES(DFS_Heap_SearchArena, 10000000, 10000000);
+DEAMER_ALGORITHM_BENCHMARK_SHAPES(DFS_Context_Search, 10000000, 10000000);
+DEAMER_ALGORITHM_BENCHMARK_SHAPES(DFS_Heap_SearchPrefetch, 10000000, 10000000);
+DEAMER_ALGORITHM_BENCHMARK_SHAPES(DFS_Heap_SearchCounted, 10000000, 10000000);
+DEAMER_ALGORITHM_BENCHMARK_SHAPES(DFS_Heap_SearchPacked, 10000000, 10000000);
+DEAMER_ALGORITHM_BENCHMARK_SHAPES(DFS_Heap_SearchParent, 10000000, 10000000);
+DEAMER_ALGORITHM_BENCHMARK_SHAPES(DFS_Stack_Search, 10000000, 10000000);
+DEAMER_ALGORITHM_BENCHMARK_SHAPES(DFS_Execute_Heap, 10000000, 10000000);
+DEAMER_ALGORITHM_BENCHMARK_SHAPES(DFS_Execute_HeapParent, 10000000, 10000000);
+DEAMER_ALGORITHM_BENCHMARK_SHAPES(DFS_Execute_Streaming, 10000000, 10000000);
+DEAMER_ALGORITHM_BENCHMARK_SHAPES(DFS_Execute_StreamingReference, 10000000, 10000000);
+DEAMER_ALGORITHM_BENCHMARK_SHAPES(DFS_Execute_Stack, 10000000, 10000000);
+DEAMER_ALGORITHM_BENCHMARK_SHAPES(DFS_Fold_SubtreeSize, 10000000, 10000000);
+DEAMER_ALGORITHM_BENCHMARK_SHAPES(DFS_Fold_SubtreeSizeMap, 1000000, 1000000);
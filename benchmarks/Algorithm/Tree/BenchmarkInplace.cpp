@@ -0,0 +1,81 @@
+#include "Algorithm/Tree/Trees.h"
+#include "Deamer/Algorithm/Tree/Inplace.h"
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+using deamer::algorithm::benchmarks::GetTree;
+using deamer::algorithm::benchmarks::Node;
+using deamer::algorithm::benchmarks::Shape;
+using deamer::algorithm::tree::Inplace;
+
+// Computes the ancestor chains of 1000 nodes spread over the tree.
+// The processed nodes are the total length of the chains.
+static void Inplace_Heap_RequiredCalls(benchmark::State& state, Shape shape)
+{
+	const auto& tree = GetTree(shape, static_cast<std::size_t>(state.range(0)));
+	const auto step = std::max<std::size_t>(1, tree.Size() / 1000);
+	std::size_t nodes = 0;
+
+	for (auto _ : state)
+	{
+		for (std::size_t i = step - 1; i < tree.Size(); i += step)
+		{
+			const auto calls =
+				Inplace::Heap::RequiredCalls(tree.Nodes()[i].get(), &Node::GetParent);
+			nodes += calls.size();
+			benchmark::DoNotOptimize(calls);
+		}
+	}
+
+	state.counters["nodes"] =
+		benchmark::Counter(static_cast<double>(nodes), benchmark::Counter::kIsRate);
+}
+
+// Folds the same ancestor chains, without storing them.
+static void Inplace_Fold(benchmark::State& state, Shape shape)
+{
+	const auto& tree = GetTree(shape, static_cast<std::size_t>(state.range(0)));
+	const auto step = std::max<std::size_t>(1, tree.Size() / 1000);
+	std::size_t nodes = 0;
+
+	for (auto _ : state)
+	{
+		for (std::size_t i = step - 1; i < tree.Size(); i += step)
+		{
+			const auto length = Inplace::Fold(
+				tree.Nodes()[i].get(), &Node::GetParent, [](Node*) { return std::size_t(1); },
+				std::plus<std::size_t>());
+			nodes += *length;
+			benchmark::DoNotOptimize(length);
+		}
+	}
+
+	state.counters["nodes"] =
+		benchmark::Counter(static_cast<double>(nodes), benchmark::Counter::kIsRate);
+}
+
+// Computes the depth of every node, the processed nodes are the nodes of the tree.
+static void Inplace_Batch_Fold(benchmark::State& state, Shape shape)
+{
+	const auto& tree = GetTree(shape, static_cast<std::size_t>(state.range(0)));
+	std::vector<Node*> starts;
+	for (const auto& node : tree.Nodes())
+	{
+		starts.push_back(node.get());
+	}
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(Inplace::Batch::Fold(
+			starts, &Node::GetParent, [](Node*) { return std::size_t(1); },
+			std::plus<std::size_t>()));
+	}
+
+	state.counters["nodes"] = benchmark::Counter(
+		static_cast<double>(state.iterations() * tree.Size()), benchmark::Counter::kIsRate);
+}
+
+DEAMER_ALGORITHM_BENCHMARK_SHAPES(Inplace_Heap_RequiredCalls, 100000, 10000000);
+DEAMER_ALGORITHM_BENCHMARK_SHAPES(Inplace_Fold, 100000, 10000000);
+DEAMER_ALGORITHM_BENCHMARK_SHAPES(Inplace_Batch_Fold, 1000000, 1000000);
@@ -0,0 +1,124 @@
+#include "Algorithm/Tree/Trees.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <random>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+namespace
+{
+	std::atomic<std::size_t> allocatedBytes = 0;
+}
+
+void* operator new(std::size_t size)
+{
+	allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+	if (auto* pointer = std::malloc(size == 0 ? 1 : size))
+	{
+		return pointer;
+	}
+	throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+	return operator new(size);
+}
+
+void operator delete(void* pointer) noexcept
+{
+	std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+	std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+	std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept
+{
+	std::free(pointer);
+}
+
+namespace deamer::algorithm::benchmarks
+{
+	Tree::Tree(Shape shape, std::size_t size)
+	{
+		std::mt19937_64 random(size);
+		nodes.reserve(size);
+		nodes.push_back(std::make_unique<Node>());
+
+		for (std::size_t i = 1; i < size; i++)
+		{
+			Node* parent = nullptr;
+			switch (shape)
+			{
+			case Shape::Chain: {
+				parent = nodes[i - 1].get();
+				break;
+			}
+			case Shape::Fan: {
+				parent = nodes[0].get();
+				break;
+			}
+			case Shape::Balanced: {
+				parent = nodes[(i - 1) / 4].get();
+				break;
+			}
+			case Shape::Random: {
+				parent = nodes[std::uniform_int_distribution<std::size_t>(0, i - 1)(random)].get();
+				break;
+			}
+			}
+
+			nodes.push_back(std::make_unique<Node>());
+			nodes.back()->parent = parent;
+			parent->subNodes.push_back(nodes.back().get());
+		}
+	}
+
+	const Tree& GetTree(Shape shape, std::size_t size)
+	{
+		static std::unique_ptr<Tree> tree;
+		static Shape treeShape = Shape::Chain;
+
+		if (tree == nullptr || treeShape != shape || tree->Size() != size)
+		{
+			tree = nullptr;
+			tree = std::make_unique<Tree>(shape, size);
+			treeShape = shape;
+		}
+
+		return *tree;
+	}
+
+	std::size_t AllocatedBytes()
+	{
+		return allocatedBytes.load(std::memory_order_relaxed);
+	}
+
+	std::size_t PeakResidentBytes()
+	{
+#if defined(__APPLE__)
+		rusage usage{};
+		getrusage(RUSAGE_SELF, &usage);
+		return static_cast<std::size_t>(usage.ru_maxrss);
+#elif defined(__unix__)
+		rusage usage{};
+		getrusage(RUSAGE_SELF, &usage);
+		return static_cast<std::size_t>(usage.ru_maxrss) * 1024;
+#else
+		return 0;
+#endif
+	}
+}
+
+BENCHMARK_MAIN();
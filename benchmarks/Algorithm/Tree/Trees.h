@@ -0,0 +1,121 @@
+#ifndef DEAMER_ALGORITHM_BENCHMARKS_TREE_TREES_H
+#define DEAMER_ALGORITHM_BENCHMARKS_TREE_TREES_H
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace deamer::algorithm::benchmarks
+{
+	struct Node
+	{
+		Node* parent = nullptr;
+		std::vector<Node*> subNodes;
+
+		Node* GetParent() const
+		{
+			return parent;
+		}
+
+		// Returns a copy, as the extension functions used in practice do.
+		std::vector<Node*> GetSubNodes() const
+		{
+			return subNodes;
+		}
+
+		// Allocation-free alternative to GetSubNodes.
+		const std::vector<Node*>& SubNodes() const
+		{
+			return subNodes;
+		}
+	};
+
+	enum class Shape
+	{
+		Chain,	  // every node has a single child
+		Fan,	  // every node is a child of the root
+		Balanced, // every node has four children
+		Random,	  // every node is a child of a uniformly chosen earlier node
+	};
+
+	class Tree
+	{
+	public:
+		Tree(Shape shape, std::size_t size);
+
+		Node* Root() const
+		{
+			return nodes.front().get();
+		}
+
+		std::size_t Size() const
+		{
+			return nodes.size();
+		}
+
+		// Nodes in creation order.
+		const std::vector<std::unique_ptr<Node>>& Nodes() const
+		{
+			return nodes;
+		}
+
+	private:
+		std::vector<std::unique_ptr<Node>> nodes;
+	};
+
+	// Returns a tree of the given shape and size.
+	// Only the last requested tree is kept, building the large trees dominates otherwise.
+	const Tree& GetTree(Shape shape, std::size_t size);
+
+	// Total amount of bytes allocated through operator new since the start of the process.
+	std::size_t AllocatedBytes();
+
+	// Peak resident set size of the process in bytes, 0 if unsupported.
+	std::size_t PeakResidentBytes();
+
+	// Runs the function on the root of the tree of the given shape, with size state.range(0).
+	// Reports the processed nodes per second, the bytes allocated per iteration and the peak RSS.
+	template<typename Function_>
+	void Run(benchmark::State& state, Shape shape, Function_ function)
+	{
+		const auto& tree = GetTree(shape, static_cast<std::size_t>(state.range(0)));
+		const auto allocatedBefore = AllocatedBytes();
+
+		for (auto _ : state)
+		{
+			function(tree.Root());
+		}
+
+		const auto iterations = static_cast<double>(state.iterations());
+		state.counters["nodes"] = benchmark::Counter(iterations * static_cast<double>(tree.Size()),
+													 benchmark::Counter::kIsRate);
+		state.counters["bytes_allocated"] =
+			benchmark::Counter(static_cast<double>(AllocatedBytes() - allocatedBefore) / iterations,
+							   benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+		state.counters["peak_rss"] =
+			benchmark::Counter(static_cast<double>(PeakResidentBytes()),
+							   benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+	}
+}
+
+// Registers the benchmark for every shape, for trees of 1e3 up to the given maximum of nodes.
+#define DEAMER_ALGORITHM_BENCHMARK_SHAPES(function, chainMaximum, maximum)                        \
+	BENCHMARK_CAPTURE(function, chain, deamer::algorithm::benchmarks::Shape::Chain)                \
+		->RangeMultiplier(10)                                                                      \
+		->Range(1000, chainMaximum)                                                                \
+		->Unit(benchmark::kMillisecond);                                                           \
+	BENCHMARK_CAPTURE(function, fan, deamer::algorithm::benchmarks::Shape::Fan)                    \
+		->RangeMultiplier(10)                                                                      \
+		->Range(1000, maximum)                                                                     \
+		->Unit(benchmark::kMillisecond);                                                           \
+	BENCHMARK_CAPTURE(function, balanced, deamer::algorithm::benchmarks::Shape::Balanced)          \
+		->RangeMultiplier(10)                                                                      \
+		->Range(1000, maximum)                                                                     \
+		->Unit(benchmark::kMillisecond);                                                           \
+	BENCHMARK_CAPTURE(function, random, deamer::algorithm::benchmarks::Shape::Random)              \
+		->RangeMultiplier(10)                                                                      \
+		->Range(1000, maximum)                                                                     \
+		->Unit(benchmark::kMillisecond)
+
+#endif // DEAMER_ALGORITHM_BENCHMARKS_TREE_TREES_H
@@ -0,0 +1,45 @@
+#ifndef DEAMER_ALGORITHM_MEMORY_ALLOCATOR_H
+#define DEAMER_ALGORITHM_MEMORY_ALLOCATOR_H
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+
+namespace deamer::algorithm::memory
+{
+	/*!	\class Allocator
+	 *
+	 *	\brief Struct containing meta functions to use a caller supplied allocator for the
+	 *	buffers of an algorithm.
+	 *
+	 *	\details Algorithms accepting an allocator take std::allocator_arg followed by either:
+	 *	- an allocator of any value type, it is rebound for every buffer
+	 *	- a std::pmr::memory_resource pointer, e.g. a std::pmr::monotonic_buffer_resource
+	 *
+	 *	Every buffer of the algorithm, including the returned vector, is allocated using it.
+	 *	Note that a memory resource is used by the thread calling the algorithm only, thus a
+	 *	resource that is not thread-safe can be used per thread.
+	 */
+	struct Allocator
+	{
+		// A memory resource is used through a polymorphic allocator, other allocators are kept.
+		template<typename Allocator_>
+		using Resolve_t =
+			std::conditional_t<std::is_convertible_v<Allocator_, std::pmr::memory_resource*>,
+							   std::pmr::polymorphic_allocator<std::byte>, Allocator_>;
+
+		// Allocator for elements of type U.
+		template<typename U, typename Allocator_>
+		using Rebind_t =
+			typename std::allocator_traits<Resolve_t<Allocator_>>::template rebind_alloc<U>;
+
+		template<typename U, typename Allocator_>
+		static Rebind_t<U, Allocator_> Rebind(const Allocator_& allocator)
+		{
+			return Rebind_t<U, Allocator_>(Resolve_t<Allocator_>(allocator));
+		}
+	};
+}
+
+#endif // DEAMER_ALGORITHM_MEMORY_ALLOCATOR_H
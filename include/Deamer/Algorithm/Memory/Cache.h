@@ -0,0 +1,34 @@
+#ifndef DEAMER_ALGORITHM_MEMORY_CACHE_H
+#define DEAMER_ALGORITHM_MEMORY_CACHE_H
+
+#if defined(_MSC_VER) && !defined(__clang__) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
+namespace deamer::algorithm::memory
+{
+	/*!	\class Cache
+	 *
+	 *	\brief Struct containing hints to the processor cache.
+	 *
+	 *	\details Hints do not change the behaviour of a program, on compilers without the
+	 *	required intrinsics they do nothing.
+	 */
+	struct Cache
+	{
+		// Requests the memory at the address to be loaded into the cache, for reading.
+		// The address is not dereferenced, thus it may be any address.
+		static void Prefetch(const void* address)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			__builtin_prefetch(address);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+			_mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#else
+			(void)address;
+#endif
+		}
+	};
+}
+
+#endif // DEAMER_ALGORITHM_MEMORY_CACHE_H
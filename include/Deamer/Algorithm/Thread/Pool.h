@@ -0,0 +1,260 @@
+#ifndef DEAMER_ALGORITHM_THREAD_POOL_H
+#define DEAMER_ALGORITHM_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace deamer::algorithm::thread
+{
+	/*!	\class Pool
+	 *
+	 *	\brief Work-stealing thread pool.
+	 *
+	 *	\details Every worker owns a deque of tasks. A worker pushes and pops its own tasks at the
+	 *	back, and steals from the front of the other deques when it runs out of work. Tasks
+	 *	submitted from a thread outside the pool are distributed round-robin over the workers.
+	 *
+	 *	Threads waiting on a TaskGroup execute pending tasks in the meantime, thus tasks may
+	 *	create and wait on nested groups without exhausting the workers.
+	 */
+	class Pool
+	{
+	public:
+		using Task = std::function<void()>;
+
+	private:
+		struct Worker
+		{
+			std::mutex mutex;
+			std::deque<Task> tasks;
+		};
+
+		std::vector<std::unique_ptr<Worker>> workers;
+		std::vector<std::thread> threads;
+
+		std::mutex sleepMutex;
+		std::condition_variable sleep;
+		std::atomic<std::size_t> pending{0};
+		std::atomic<std::size_t> next{0};
+		bool stopping = false;
+
+		inline static thread_local const Pool* currentPool = nullptr;
+		inline static thread_local std::size_t currentWorker = 0;
+
+	public:
+		explicit Pool(std::size_t threadCount = std::thread::hardware_concurrency())
+		{
+			if (threadCount == 0)
+			{
+				threadCount = 1;
+			}
+
+			for (std::size_t i = 0; i < threadCount; i++)
+			{
+				workers.push_back(std::make_unique<Worker>());
+			}
+
+			for (std::size_t i = 0; i < threadCount; i++)
+			{
+				threads.emplace_back([this, i]() { Work(i); });
+			}
+		}
+
+		~Pool()
+		{
+			{
+				std::lock_guard<std::mutex> lock(sleepMutex);
+				stopping = true;
+			}
+			sleep.notify_all();
+
+			for (auto& thread : threads)
+			{
+				thread.join();
+			}
+		}
+
+		Pool(const Pool&) = delete;
+		Pool& operator=(const Pool&) = delete;
+
+		std::size_t Size() const
+		{
+			return workers.size();
+		}
+
+		void Submit(Task task)
+		{
+			// Counted before it is pushed, such that taking it never precedes the increment.
+			{
+				std::lock_guard<std::mutex> lock(sleepMutex);
+				pending++;
+			}
+
+			const auto index = currentPool == this ? currentWorker : next++ % workers.size();
+			{
+				std::lock_guard<std::mutex> lock(workers[index]->mutex);
+				workers[index]->tasks.push_back(std::move(task));
+			}
+			sleep.notify_one();
+		}
+
+		// Executes a single pending task, if there is any.
+		// Returns true if a task was executed.
+		bool RunPending()
+		{
+			Task task;
+			if (!Take(task))
+			{
+				return false;
+			}
+
+			task();
+			return true;
+		}
+
+	private:
+		bool Take(Task& task)
+		{
+			const bool isWorker = currentPool == this;
+			const auto begin = isWorker ? currentWorker : next.load() % workers.size();
+
+			if (isWorker)
+			{
+				auto& worker = *workers[begin];
+				std::lock_guard<std::mutex> lock(worker.mutex);
+				if (!worker.tasks.empty())
+				{
+					task = std::move(worker.tasks.back());
+					worker.tasks.pop_back();
+					pending--;
+					return true;
+				}
+			}
+
+			for (std::size_t i = isWorker ? 1 : 0; i < workers.size(); i++)
+			{
+				auto& victim = *workers[(begin + i) % workers.size()];
+				std::lock_guard<std::mutex> lock(victim.mutex);
+				if (!victim.tasks.empty())
+				{
+					task = std::move(victim.tasks.front());
+					victim.tasks.pop_front();
+					pending--;
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		void Work(std::size_t index)
+		{
+			currentPool = this;
+			currentWorker = index;
+
+			while (true)
+			{
+				if (RunPending())
+				{
+					continue;
+				}
+
+				std::unique_lock<std::mutex> lock(sleepMutex);
+				sleep.wait(lock, [this]() { return stopping || pending > 0; });
+				if (stopping && pending == 0)
+				{
+					return;
+				}
+			}
+		}
+	};
+
+	/*!	\class TaskGroup
+	 *
+	 *	\brief Set of tasks executed on a Pool, which can be waited on as a whole.
+	 *
+	 *	\details The first exception thrown by a task is rethrown by Wait.
+	 *	The destructor waits for the remaining tasks, without rethrowing.
+	 */
+	class TaskGroup
+	{
+	private:
+		Pool& pool;
+		std::atomic<std::size_t> remaining{0};
+		std::mutex exceptionMutex;
+		std::exception_ptr exception;
+
+	public:
+		explicit TaskGroup(Pool& pool_) : pool(pool_)
+		{
+		}
+
+		~TaskGroup()
+		{
+			Join();
+		}
+
+		TaskGroup(const TaskGroup&) = delete;
+		TaskGroup& operator=(const TaskGroup&) = delete;
+
+		template<typename Function_>
+		void Run(Function_&& function)
+		{
+			remaining++;
+			pool.Submit([this, function = std::forward<Function_>(function)]() mutable {
+				try
+				{
+					function();
+				}
+				catch (...)
+				{
+					std::lock_guard<std::mutex> lock(exceptionMutex);
+					if (exception == nullptr)
+					{
+						exception = std::current_exception();
+					}
+				}
+				remaining.fetch_sub(1, std::memory_order_acq_rel);
+			});
+		}
+
+		// Executes pending tasks of the pool until all tasks of this group are done.
+		void Wait()
+		{
+			Join();
+
+			std::exception_ptr thrown;
+			{
+				std::lock_guard<std::mutex> lock(exceptionMutex);
+				std::swap(thrown, exception);
+			}
+			if (thrown != nullptr)
+			{
+				std::rethrow_exception(thrown);
+			}
+		}
+
+	private:
+		void Join()
+		{
+			while (remaining.load(std::memory_order_acquire) != 0)
+			{
+				if (!pool.RunPending())
+				{
+					std::this_thread::yield();
+				}
+			}
+		}
+	};
+}
+
+#endif // DEAMER_ALGORITHM_THREAD_POOL_H
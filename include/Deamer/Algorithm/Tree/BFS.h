@@ -1,9 +1,19 @@
 #ifndef DEAMER_ALGORITHM_TREE_BFS_H
 #define DEAMER_ALGORITHM_TREE_BFS_H
 
+#include "Deamer/Algorithm/Memory/Allocator.h"
+#include "Deamer/Algorithm/Tree/Control.h"
+#include "Deamer/Algorithm/Tree/Extension.h"
+#include "Deamer/Algorithm/Tree/PackedActions.h"
+#include "Deamer/Algorithm/Tree/Prefetch.h"
+#include "Deamer/Algorithm/Tree/SizeHint.h"
+#include <algorithm>
+#include <cstddef>
 #include <functional>
 #include <iostream>
+#include <iterator>
 #include <map>
+#include <memory>
 #include <set>
 #include <stack>
 #include <vector>
@@ -25,54 +35,396 @@ namespace deamer::algorithm::tree
 			Exit,
 		};
 
+		// Shared by all engines, see tree::Control.
+		using Control = tree::Control;
+
+		// Output of a search, storing objects as the pointer type T.
+		// Allocated using the given allocator or memory resource, see memory::Allocator.
+		template<typename T, typename Allocator_ = std::allocator<std::byte>>
+		using Actions_t =
+			std::vector<std::pair<T, Action>,
+						memory::Allocator::Rebind_t<std::pair<T, Action>, Allocator_>>;
+
 		template<typename T, typename ExtensionFunction_>
 		static std::vector<std::pair<T*, Action>> Search(T* init,
 														 ExtensionFunction_ ExtensionFunction)
+		{
+			return BFS::Search(std::allocator_arg, std::allocator<std::byte>(), init,
+							   ExtensionFunction);
+		}
+
+		// Reserves the output at once, see SizeHint.
+		template<typename T, typename ExtensionFunction_>
+		static std::vector<std::pair<T*, Action>>
+		Search(T* init, ExtensionFunction_ ExtensionFunction, SizeHint hint)
+		{
+			std::vector<std::pair<T*, Action>> actions;
+			hint.Reserve(actions, init, ExtensionFunction);
+			BFS::Search(actions, init, ExtensionFunction);
+
+			return actions;
+		}
+
+		template<typename Allocator_, typename T, typename ExtensionFunction_>
+		static Actions_t<T*, Allocator_> Search(std::allocator_arg_t, const Allocator_& allocator,
+												T* init, ExtensionFunction_ ExtensionFunction)
+		{
+			Actions_t<T*, Allocator_> actions(
+				memory::Allocator::Rebind<std::pair<T*, Action>>(allocator));
+			BFS::Search(actions, init, ExtensionFunction);
+
+			return actions;
+		}
+
+		// Appends the actions to the given vector, reusing its capacity.
+		template<typename T, typename VectorAllocator_, typename ExtensionFunction_>
+		static void Search(std::vector<std::pair<T*, Action>, VectorAllocator_>& actions, T* init,
+						   ExtensionFunction_ ExtensionFunction)
+		{
+			BFS::Append(actions, init, ExtensionFunction);
+		}
+
+		// Prefetches upcoming objects in the queue, see Prefetch.
+		template<typename T, typename ExtensionFunction_, typename AddressFunction_>
+		static std::vector<std::pair<T*, Action>>
+		Search(T* init, ExtensionFunction_ ExtensionFunction,
+			   const Prefetch<AddressFunction_>& prefetch)
+		{
+			std::vector<std::pair<T*, Action>> actions;
+			BFS::Append(actions, init, ExtensionFunction, prefetch);
+
+			return actions;
+		}
+
+		// Stores the actions packed, using half the memory, see PackedActions.
+		template<typename T, typename ExtensionFunction_>
+		static PackedActions<T, Action> SearchPacked(T* init, ExtensionFunction_ ExtensionFunction)
+		{
+			PackedActions<T, Action> actions;
+			BFS::Append(actions, init, ExtensionFunction);
+
+			return actions;
+		}
+
+		// Reserves the packed output at once, see SizeHint.
+		template<typename T, typename ExtensionFunction_>
+		static PackedActions<T, Action> SearchPacked(T* init, ExtensionFunction_ ExtensionFunction,
+													 SizeHint hint)
+		{
+			PackedActions<T, Action> actions;
+			hint.Reserve(actions, init, ExtensionFunction);
+			BFS::Append(actions, init, ExtensionFunction);
+
+			return actions;
+		}
+
+		template<typename T, typename ExtensionFunction_>
+		static void Search(PackedActions<T, Action>& actions, T* init,
+						   ExtensionFunction_ ExtensionFunction)
+		{
+			BFS::Append(actions, init, ExtensionFunction);
+		}
+
+		// Range over [first, last).
+		template<typename Iterator_>
+		class Slice
+		{
+		public:
+			Slice(Iterator_ first_, Iterator_ last_) : first(first_), last(last_)
+			{
+			}
+
+			Iterator_ begin() const
+			{
+				return first;
+			}
+
+			Iterator_ end() const
+			{
+				return last;
+			}
+
+			std::size_t size() const
+			{
+				return static_cast<std::size_t>(std::distance(first, last));
+			}
+
+			bool empty() const
+			{
+				return first == last;
+			}
+
+		private:
+			Iterator_ first;
+			Iterator_ last;
+		};
+
+		/*!	\class LevelOrder
+		 *
+		 *	\brief Compact result of a BFS, storing every visited object once.
+		 *
+		 *	\details The entries are the objects in visit order, the exits are the objects in
+		 *	reverse visit order. Besides the objects, the offsets of the levels and the index of the
+		 *	parent of every object are stored.
+		 */
+		template<typename T>
+		class LevelOrder
+		{
+		public:
+			static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+			using const_iterator = typename std::vector<T*>::const_iterator;
+			using const_reverse_iterator = typename std::vector<T*>::const_reverse_iterator;
+
+			LevelOrder() = default;
+
+			LevelOrder(std::vector<T*> objects_, std::vector<std::size_t> levels_,
+					   std::vector<std::size_t> parents_)
+				: objects(std::move(objects_)),
+				  levels(std::move(levels_)),
+				  parents(std::move(parents_))
+			{
+			}
+
+			std::size_t Size() const
+			{
+				return objects.size();
+			}
+
+			bool Empty() const
+			{
+				return objects.empty();
+			}
+
+			T* operator[](std::size_t index) const
+			{
+				return objects[index];
+			}
+
+			// Objects in the order of their entry actions.
+			Slice<const_iterator> Entries() const
+			{
+				return {objects.cbegin(), objects.cend()};
+			}
+
+			// Objects in the order of their exit actions.
+			Slice<const_reverse_iterator> Exits() const
+			{
+				return {objects.crbegin(), objects.crend()};
+			}
+
+			std::size_t LevelCount() const
+			{
+				return levels.empty() ? 0 : levels.size() - 1;
+			}
+
+			// Objects at the given depth, the initial object is at level 0.
+			Slice<const_iterator> Level(std::size_t level) const
+			{
+				return {objects.cbegin() + levels[level], objects.cbegin() + levels[level + 1]};
+			}
+
+			// Index of the parent of the object at the given index.
+			// Returns npos for the initial object.
+			std::size_t Parent(std::size_t index) const
+			{
+				return parents[index];
+			}
+
+			// Actions equal to the output of Search.
+			std::vector<std::pair<T*, Action>> Actions() const
+			{
+				std::vector<std::pair<T*, Action>> actions;
+				actions.reserve(2 * objects.size());
+				for (auto object : Entries())
+				{
+					actions.emplace_back(object, Action::Entry);
+				}
+				for (auto object : Exits())
+				{
+					actions.emplace_back(object, Action::Exit);
+				}
+
+				return actions;
+			}
+
+		private:
+			std::vector<T*> objects;
+			std::vector<std::size_t> levels;
+			std::vector<std::size_t> parents;
+		};
+
+		// Searches the tree, storing every object once, together with its level and parent.
+		template<typename T, typename ExtensionFunction_>
+		static LevelOrder<T> Levels(T* init, ExtensionFunction_ ExtensionFunction)
 		{
 			if (init == nullptr)
 			{
 				return {};
 			}
 
-			auto t = init;
 			std::size_t index = 0;
-			std::vector<std::pair<T*, Action>> actions;
-			actions.emplace_back(t, Action::Entry);
+			std::vector<T*> objects{init};
+			std::vector<std::size_t> levels{0};
+			std::vector<std::size_t> parents{LevelOrder<T>::npos};
 
-			while (true)
+			while (index != objects.size())
 			{
-				auto stopIndex = actions.size();
+				const auto stopIndex = objects.size();
+				levels.push_back(stopIndex);
 
-				// Only possible if nothing new is added
-				// i.e. we are done
-				if (index == stopIndex)
+				for (; index < stopIndex; index++)
 				{
-					break;
+					Extension::ForEach(ExtensionFunction, objects[index], [&, index](T* subnode) {
+						objects.push_back(subnode);
+						parents.push_back(index);
+					});
 				}
+			}
 
-				for (; index < stopIndex; index++)
+			return LevelOrder<T>(std::move(objects), std::move(levels), std::move(parents));
+		}
+
+		/*!	\class LazyRange
+		 *
+		 *	\brief Input range yielding the same (object, action) pairs as Search, on demand.
+		 *
+		 *	\details Nodes are only expanded when their subnodes are required to continue the
+		 *	entries. The exits are yielded in reverse entry order, thus they require the full
+		 *	traversal. The visited nodes are shared between the iterators of a range, iterators stay
+		 *	valid after the range is destroyed.
+		 */
+		template<typename T, typename ExtensionFunction_>
+		class LazyRange
+		{
+		private:
+			struct State
+			{
+				ExtensionFunction_ extensionFunction;
+				std::vector<T*> objects;
+				std::size_t expanded = 0;
+
+				// Expands nodes until the entry at the given index is known.
+				// Returns false if the index is past the last entry.
+				bool Reach(std::size_t index)
 				{
-					auto subnodes = std::invoke(ExtensionFunction, actions[index].first);
-					for (auto subnode : subnodes)
+					while (objects.size() <= index && expanded < objects.size())
 					{
-						actions.emplace_back(subnode, Action::Entry);
+						Extension::ForEach(extensionFunction, objects[expanded++],
+										   [this](T* subnode) { objects.push_back(subnode); });
 					}
+
+					return index < objects.size();
+				}
+			};
+
+		public:
+			class iterator
+			{
+			public:
+				// Yields the pairs by value, as they are not stored beyond the current one.
+				using iterator_category = std::input_iterator_tag;
+				using value_type = std::pair<T*, Action>;
+				using difference_type = std::ptrdiff_t;
+				using pointer = void;
+				using reference = value_type;
+
+			private:
+				std::shared_ptr<State> state;
+				std::size_t index = 0;
+				value_type current{nullptr, Action::Entry};
+
+			public:
+				iterator() = default;
+
+				iterator(std::shared_ptr<State> state_) : state(std::move(state_))
+				{
+					Update();
+				}
+
+				reference operator*() const
+				{
+					return current;
+				}
+
+				iterator& operator++()
+				{
+					index++;
+					Update();
+					return *this;
+				}
+
+				iterator operator++(int)
+				{
+					auto tmp = *this;
+					++*this;
+					return tmp;
+				}
+
+				bool operator==(const iterator& rhs) const
+				{
+					return state == rhs.state && index == rhs.index;
+				}
+
+				bool operator!=(const iterator& rhs) const
+				{
+					return !(*this == rhs);
+				}
+
+			private:
+				void Update()
+				{
+					if (state == nullptr)
+					{
+						return;
+					}
+
+					if (state->Reach(index))
+					{
+						current = {state->objects[index], Action::Entry};
+						return;
+					}
+
+					// All entries are visited, the exits are in reverse order.
+					const auto size = state->objects.size();
+					if (index < 2 * size)
+					{
+						current = {state->objects[2 * size - 1 - index], Action::Exit};
+						return;
+					}
+
+					state = nullptr;
+					index = 0;
+				}
+			};
+
+			LazyRange(T* init, ExtensionFunction_ ExtensionFunction)
+				: state(std::make_shared<State>(State{ExtensionFunction, {}}))
+			{
+				if (init != nullptr)
+				{
+					state->objects.push_back(init);
 				}
 			}
 
-			auto currentEnding = actions.size();
-			for (auto i = currentEnding - 1; i > 0; --i)
+			iterator begin() const
 			{
-				auto object = actions[i].first;
-				actions.emplace_back(object, Action::Exit);
+				return iterator(state);
 			}
-			if (!actions.empty())
+
+			iterator end() const
 			{
-				auto object = actions[0].first;
-				actions.emplace_back(object, Action::Exit);
+				return iterator();
 			}
 
-			return actions;
+		private:
+			std::shared_ptr<State> state;
+		};
+
+		template<typename T, typename ExtensionFunction_>
+		static LazyRange<T, ExtensionFunction_> Range(T* init, ExtensionFunction_ ExtensionFunction)
+		{
+			return LazyRange<T, ExtensionFunction_>(init, ExtensionFunction);
 		}
 
 		struct Execute
@@ -84,28 +436,154 @@ namespace deamer::algorithm::tree
 			static void Search(T* init, ExtensionFunction_ ExtensionFunction,
 							   EntryAction_ EntryAction, ExitAction_ ExitAction)
 			{
+				Execute::Search(std::allocator_arg, std::allocator<std::byte>(), init,
+								ExtensionFunction, EntryAction, ExitAction);
+			}
+
+			template<typename Allocator_, typename T, typename ExtensionFunction_,
+					 typename EntryAction_, typename ExitAction_>
+			static void Search(std::allocator_arg_t, const Allocator_& allocator, T* init,
+							   ExtensionFunction_ ExtensionFunction, EntryAction_ EntryAction,
+							   ExitAction_ ExitAction)
+			{
+				std::vector<T*, memory::Allocator::Rebind_t<T*, Allocator_>> objects(
+					memory::Allocator::Rebind<T*>(allocator));
+				Execute::Search(objects, init, ExtensionFunction, EntryAction, ExitAction);
+			}
+
+			// Uses the given vector to store the objects, reusing its capacity.
+			template<typename T, typename VectorAllocator_, typename ExtensionFunction_,
+					 typename EntryAction_, typename ExitAction_>
+			static void Search(std::vector<T*, VectorAllocator_>& objects, T* init,
+							   ExtensionFunction_ ExtensionFunction, EntryAction_ EntryAction,
+							   ExitAction_ ExitAction)
+			{
+				objects.clear();
 				if (init == nullptr)
 				{
 					return;
 				}
 
-				const auto actions = BFS::Search(init, ExtensionFunction);
-				for (auto [object, action] : actions)
+				// Nodes are expanded after their entry, such that skipped subtrees are never
+				// expanded. The order of the calls is equal to the order of Search.
+				objects.push_back(init);
+				for (std::size_t index = 0; index < objects.size(); index++)
 				{
-					switch (action)
+					const auto control = Visitor::Call(EntryAction, objects[index]);
+					if (control == Control::Stop)
 					{
-					case Action::Entry: {
-						EntryAction(object);
-						break;
+						return;
 					}
-					case Action::Exit: {
-						ExitAction(object);
-						break;
+					if (control == Control::SkipChildren)
+					{
+						continue;
 					}
+
+					Extension::ForEach(ExtensionFunction, objects[index],
+									   [&objects](T* subnode) { objects.push_back(subnode); });
+				}
+
+				for (auto i = std::rbegin(objects); i != std::rend(objects); ++i)
+				{
+					if (Visitor::Call(ExitAction, *i) == Control::Stop)
+					{
+						return;
 					}
 				}
 			}
 		};
+
+		/*!	\class Context
+		 *
+		 *	\brief Owns the buffers of a search, such that repeated searches reuse their capacity.
+		 *
+		 *	\details Once the buffers have grown to the size of the largest tree searched, searches
+		 *	using the context do not allocate. The actions returned by Search are stored in the
+		 *	context, they are valid until the next search using the same context.
+		 */
+		template<typename T, typename Allocator_ = std::allocator<std::byte>>
+		class Context
+		{
+		private:
+			Actions_t<T*, Allocator_> actions;
+			std::vector<T*, memory::Allocator::Rebind_t<T*, Allocator_>> objects;
+
+		public:
+			explicit Context(const Allocator_& allocator = Allocator_())
+				: actions(memory::Allocator::Rebind<std::pair<T*, Action>>(allocator)),
+				  objects(memory::Allocator::Rebind<T*>(allocator))
+			{
+			}
+
+			template<typename ExtensionFunction_>
+			const Actions_t<T*, Allocator_>& Search(T* init, ExtensionFunction_ ExtensionFunction)
+			{
+				actions.clear();
+				BFS::Search(actions, init, ExtensionFunction);
+
+				return actions;
+			}
+
+			// Equal to Execute::Search.
+			template<typename ExtensionFunction_, typename EntryAction_, typename ExitAction_>
+			void Execute(T* init, ExtensionFunction_ ExtensionFunction, EntryAction_ EntryAction,
+						 ExitAction_ ExitAction)
+			{
+				BFS::Execute::Search(objects, init, ExtensionFunction, EntryAction, ExitAction);
+			}
+		};
+
+	private:
+		// The actions are used as queue, thus Actions_ is required to be indexable.
+		template<typename Actions_, typename T, typename ExtensionFunction_,
+				 typename Prefetch_ = std::nullptr_t>
+		static void Append(Actions_& actions, T* init, ExtensionFunction_ ExtensionFunction,
+						   const Prefetch_& prefetch = nullptr)
+		{
+			if (init == nullptr)
+			{
+				return;
+			}
+
+			auto t = init;
+			const auto first = actions.size();
+			auto index = first;
+			actions.emplace_back(t, Action::Entry);
+
+			while (true)
+			{
+				auto stopIndex = actions.size();
+
+				// Only possible if nothing new is added
+				// i.e. we are done
+				if (index == stopIndex)
+				{
+					break;
+				}
+
+				for (; index < stopIndex; index++)
+				{
+					if constexpr (!std::is_null_pointer_v<Prefetch_>)
+					{
+						prefetch.Ahead(index, actions.size(), [&actions](std::size_t i) {
+							return actions[i].first;
+						});
+					}
+					Extension::ForEach(ExtensionFunction, actions[index].first,
+									   [&actions](T* subnode) {
+										   actions.emplace_back(subnode, Action::Entry);
+									   });
+				}
+			}
+
+			auto currentEnding = actions.size();
+			for (auto i = currentEnding - 1; i > first; --i)
+			{
+				auto object = actions[i].first;
+				actions.emplace_back(object, Action::Exit);
+			}
+			actions.emplace_back(init, Action::Exit);
+		}
 	};
 }
 
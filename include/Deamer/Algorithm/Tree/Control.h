@@ -0,0 +1,48 @@
+#ifndef DEAMER_ALGORITHM_TREE_CONTROL_H
+#define DEAMER_ALGORITHM_TREE_CONTROL_H
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace deamer::algorithm::tree
+{
+	// Entry and exit functions may return a Control to steer the traversal.
+	// Functions returning anything else are treated as returning Continue.
+	// - SkipChildren: returned on entry, the subnodes are not expanded; the exit is still
+	// executed. On exit it is equal to Continue.
+	// - Stop: ends the traversal, no other function is executed.
+	enum class Control
+	{
+		Continue,
+		SkipChildren,
+		Stop,
+	};
+
+	/*!	\class Visitor
+	 *
+	 *	\brief Struct containing meta functions to call the functions given to a traversal.
+	 *
+	 *	\details Shared by all engines, thus a function written for one engine steers any other
+	 *	engine in the same way.
+	 */
+	struct Visitor
+	{
+		// Calls the function, returning its Control or Continue if it does not return a Control.
+		template<typename Function_, typename... Args>
+		static Control Call(Function_&& function, Args&&... args)
+		{
+			if constexpr (std::is_same_v<std::invoke_result_t<Function_, Args...>, Control>)
+			{
+				return std::invoke(std::forward<Function_>(function), std::forward<Args>(args)...);
+			}
+			else
+			{
+				std::invoke(std::forward<Function_>(function), std::forward<Args>(args)...);
+				return Control::Continue;
+			}
+		}
+	};
+}
+
+#endif // DEAMER_ALGORITHM_TREE_CONTROL_H
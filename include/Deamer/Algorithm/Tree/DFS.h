@@ -1,10 +1,20 @@
 #ifndef DEAMER_ALGORITHM_TREE_DFS_H
 #define DEAMER_ALGORITHM_TREE_DFS_H
 
+#include "Deamer/Algorithm/Memory/Allocator.h"
+#include "Deamer/Algorithm/Tree/Control.h"
+#include "Deamer/Algorithm/Tree/Extension.h"
+#include "Deamer/Algorithm/Tree/PackedActions.h"
+#include "Deamer/Algorithm/Tree/Prefetch.h"
+#include "Deamer/Algorithm/Tree/SizeHint.h"
+#include <algorithm>
+#include <cstddef>
 #include <functional>
 #include <iostream>
+#include <iterator>
 #include <map>
-#include <set>
+#include <memory>
+#include <optional>
 #include <stack>
 #include <vector>
 #include <type_traits>
@@ -19,7 +29,8 @@ namespace deamer::algorithm::tree
 	 *
 	 *	\warning This class assumes that the user has gives the following signatures:
 	 *	- ExtensionFunction accepts the init object
-	 *	- ExtensionFunction returns an STL type such as: vector, or type having "value_type" alias
+	 *	- ExtensionFunction is one of the forms supported by Extension: returning a range, such as
+	 *	vector, returning a pair of iterators, or accepting an Extension::Sink
 	 *	- ParentFunction accepts the init object
 	 *	- ParentFunction returns raw pointer
 	 *
@@ -37,270 +48,437 @@ namespace deamer::algorithm::tree
 			Exit,
 		};
 
+		// Shared by all engines, see tree::Control.
+		using Control = tree::Control;
+
+		// Output of a search, storing objects as the pointer type T.
+		// Allocated using the given allocator or memory resource, see memory::Allocator.
+		template<typename T, typename Allocator_ = std::allocator<std::byte>>
+		using Actions_t =
+			std::vector<std::pair<T, Action>,
+						memory::Allocator::Rebind_t<std::pair<T, Action>, Allocator_>>;
+
 		// Algorithms using Heap approach
 		// Will not cause stack overflows on large inputs.
 		// Note the output contains twice the objects that were given as input.
 		struct Heap
 		{
-			// This is slower than variant using the Parent function.
-			// This is due to required lookup whether a node has been visited already.
+			// Pointer type able to store the objects of a search using a parent function.
+			template<typename T, typename ParentFunction_, typename ExtensionFunction_>
+			using ParentStore_t = std::conditional_t<
+				std::is_const_v<
+					std::remove_pointer_t<std::invoke_result_t<ParentFunction_&, T*>>>,
+				const T*, Extension::Store_t<T, ExtensionFunction_>>;
+
+			// Progress is tracked using a stack of frames, each containing the position in the
+			// subnodes of its node. Thus no lookup is required to check if a node has been visited.
 			template<typename T, typename ExtensionFunction_>
 			static auto Search(T* init, ExtensionFunction_ ExtensionFunction)
-				-> std::vector<std::pair<
-					std::conditional_t<
-						std::is_const_v<T> ||
-							std::is_const_v<std::remove_pointer_t<typename decltype(std::invoke(
-								ExtensionFunction, init))::value_type>>,
-						const T*, T*>,
-					Action>>
+				-> Actions_t<Extension::Store_t<T, ExtensionFunction_>>
+			{
+				return DFS::Heap::Search(std::allocator_arg, std::allocator<std::byte>(), init,
+										 ExtensionFunction);
+			}
+
+			// Reserves the output at once, see SizeHint.
+			template<typename T, typename ExtensionFunction_>
+			static auto Search(T* init, ExtensionFunction_ ExtensionFunction, SizeHint hint)
+				-> Actions_t<Extension::Store_t<T, ExtensionFunction_>>
+			{
+				Actions_t<Extension::Store_t<T, ExtensionFunction_>> actions;
+				hint.Reserve(actions, init, ExtensionFunction);
+				DFS::Heap::Search(actions, init, ExtensionFunction);
+
+				return actions;
+			}
+
+			template<typename Allocator_, typename T, typename ExtensionFunction_>
+			static auto Search(std::allocator_arg_t, const Allocator_& allocator, T* init,
+							   ExtensionFunction_ ExtensionFunction)
+				-> Actions_t<Extension::Store_t<T, ExtensionFunction_>, Allocator_>
+			{
+				using store_T = Extension::Store_t<T, ExtensionFunction_>;
+
+				Actions_t<store_T, Allocator_> actions(
+					memory::Allocator::Rebind<std::pair<store_T, Action>>(allocator));
+				DFS::Heap::Search(actions, init, ExtensionFunction);
+
+				return actions;
+			}
+
+			// Appends the actions to the given vector, reusing its capacity.
+			// Scratch buffers use the allocator of the vector.
+			template<typename store_T, typename VectorAllocator_, typename T,
+					 typename ExtensionFunction_>
+			static void Search(std::vector<std::pair<store_T, Action>, VectorAllocator_>& actions,
+							   T* init, ExtensionFunction_ ExtensionFunction)
+			{
+				DFS::Heap::Traverse(std::allocator_arg, actions.get_allocator(), init,
+									ExtensionFunction, [&actions](store_T object, Action action) {
+										actions.emplace_back(object, action);
+									});
+			}
+
+			// Prefetches upcoming nodes, see Prefetch.
+			template<typename T, typename ExtensionFunction_, typename AddressFunction_>
+			static auto Search(T* init, ExtensionFunction_ ExtensionFunction,
+							   const Prefetch<AddressFunction_>& prefetch)
+			{
+				using store_T = Extension::Store_t<T, ExtensionFunction_>;
+
+				Actions_t<store_T> actions;
+				Buffers<store_T> buffers;
+				DFS::Heap::Traverse(
+					buffers, init, ExtensionFunction,
+					[&actions](store_T object, Action action) {
+						actions.emplace_back(object, action);
+					},
+					prefetch);
+
+				return actions;
+			}
+
+			// Stores the actions packed, using half the memory, see PackedActions.
+			template<typename T, typename ExtensionFunction_>
+			static auto SearchPacked(T* init, ExtensionFunction_ ExtensionFunction)
+				-> PackedActions<std::remove_pointer_t<Extension::Store_t<T, ExtensionFunction_>>,
+								 Action>
+			{
+				PackedActions<std::remove_pointer_t<Extension::Store_t<T, ExtensionFunction_>>,
+							  Action>
+					actions;
+				DFS::Heap::Search(actions, init, ExtensionFunction);
+
+				return actions;
+			}
+
+			// Reserves the packed output at once, see SizeHint.
+			template<typename T, typename ExtensionFunction_>
+			static auto SearchPacked(T* init, ExtensionFunction_ ExtensionFunction, SizeHint hint)
+				-> PackedActions<std::remove_pointer_t<Extension::Store_t<T, ExtensionFunction_>>,
+								 Action>
+			{
+				PackedActions<std::remove_pointer_t<Extension::Store_t<T, ExtensionFunction_>>,
+							  Action>
+					actions;
+				hint.Reserve(actions, init, ExtensionFunction);
+				DFS::Heap::Search(actions, init, ExtensionFunction);
+
+				return actions;
+			}
+
+			template<typename U, typename T, typename ExtensionFunction_>
+			static void Search(PackedActions<U, Action>& actions, T* init,
+							   ExtensionFunction_ ExtensionFunction)
 			{
+				DFS::Heap::Traverse(init, ExtensionFunction, [&actions](U* object, Action action) {
+					actions.emplace_back(object, action);
+				});
+			}
+
+			// Uses the parent function to climb back up, thus only the position in the subnodes of
+			// every node on the current path has to be stored.
+			template<typename T, typename ParentFunction_, typename ExtensionFunction_>
+			static auto Search(T* init, ParentFunction_ GetParentFunction,
+							   ExtensionFunction_ ExtensionFunction)
+				-> Actions_t<ParentStore_t<T, ParentFunction_, ExtensionFunction_>>
+			{
+				return DFS::Heap::Search(std::allocator_arg, std::allocator<std::byte>(), init,
+										 GetParentFunction, ExtensionFunction);
+			}
+
+			template<typename T, typename ParentFunction_, typename ExtensionFunction_>
+			static auto Search(T* init, ParentFunction_ GetParentFunction,
+							   ExtensionFunction_ ExtensionFunction, SizeHint hint)
+				-> Actions_t<ParentStore_t<T, ParentFunction_, ExtensionFunction_>>
+			{
+				Actions_t<ParentStore_t<T, ParentFunction_, ExtensionFunction_>> actions;
+				hint.Reserve(actions, init, ExtensionFunction);
+				DFS::Heap::Search(actions, init, GetParentFunction, ExtensionFunction);
+
+				return actions;
+			}
+
+			template<typename Allocator_, typename T, typename ParentFunction_,
+					 typename ExtensionFunction_>
+			static auto Search(std::allocator_arg_t, const Allocator_& allocator, T* init,
+							   ParentFunction_ GetParentFunction,
+							   ExtensionFunction_ ExtensionFunction)
+				-> Actions_t<ParentStore_t<T, ParentFunction_, ExtensionFunction_>, Allocator_>
+			{
+				using store_T = ParentStore_t<T, ParentFunction_, ExtensionFunction_>;
+
+				Actions_t<store_T, Allocator_> actions(
+					memory::Allocator::Rebind<std::pair<store_T, Action>>(allocator));
+				DFS::Heap::Search(actions, init, GetParentFunction, ExtensionFunction);
+
+				return actions;
+			}
+
+			template<typename store_T, typename VectorAllocator_, typename T,
+					 typename ParentFunction_, typename ExtensionFunction_>
+			static void Search(std::vector<std::pair<store_T, Action>, VectorAllocator_>& actions,
+							   T* init, ParentFunction_ GetParentFunction,
+							   ExtensionFunction_ ExtensionFunction)
+			{
+				// The subnodes of a frame are stored in subnodes[begin, subnodes.size()),
+				// as long as the frame is at the top of the stack.
+				// The node of a frame is not stored, it is retrieved using the parent function.
+				struct Frame
+				{
+					std::size_t begin;
+					std::size_t next;
+				};
+
 				if (init == nullptr)
 				{
-					return {};
-				}
-
-				std::conditional_t<
-					std::is_const_v<T> ||
-						std::is_const_v<std::remove_pointer_t<typename decltype(std::invoke(
-							ExtensionFunction, init))::value_type>>,
-					const T*, T*>
-					t = init;
-				std::stack<std::conditional_t<
-					std::is_const_v<T> ||
-						std::is_const_v<std::remove_pointer_t<typename decltype(std::invoke(
-							ExtensionFunction, init))::value_type>>,
-					const T*, T*>>
-					ts;
-				std::vector<std::pair<
-					std::conditional_t<
-						std::is_const_v<T> ||
-							std::is_const_v<std::remove_pointer_t<typename decltype(std::invoke(
-								ExtensionFunction, init))::value_type>>,
-						const T*, T*>,
-					Action>>
-					actions;
-				std::set<std::conditional_t<
-					std::is_const_v<T> ||
-						std::is_const_v<std::remove_pointer_t<typename decltype(std::invoke(
-							ExtensionFunction, init))::value_type>>,
-					const T*, T*>>
-					visited;
-
-				ts.push(t);
+					return;
+				}
+
+				const auto allocator = actions.get_allocator();
+				std::vector<store_T, memory::Allocator::Rebind_t<store_T, VectorAllocator_>>
+					subnodes(memory::Allocator::Rebind<store_T>(allocator));
+				std::vector<Frame, memory::Allocator::Rebind_t<Frame, VectorAllocator_>> frames(
+					memory::Allocator::Rebind<Frame>(allocator));
+				store_T t = init;
+
 				while (true)
 				{
-					if (visited.find(t) == visited.end())
+					actions.emplace_back(t, Action::Entry);
+
+					// Each node is expanded exactly once, its subnodes are cached until exit.
+					const auto begin = subnodes.size();
+					Extension::ForEach(ExtensionFunction, t, [&subnodes](store_T subnode) {
+						subnodes.push_back(subnode);
+					});
+					frames.push_back({begin, begin});
+
+					while (true)
 					{
-						actions.emplace_back(t, Action::Entry);
-						auto subnodes = std::invoke(ExtensionFunction, t);
-						for (auto i = std::rbegin(subnodes); i != std::rend(subnodes); ++i)
+						auto& frame = frames.back();
+						if (frame.next != subnodes.size())
 						{
-							ts.push((*i));
+							t = subnodes[frame.next++];
+							break;
 						}
-					}
-					else
-					{
-						ts.pop();
-						actions.emplace_back(t, Action::Exit);
-					}
 
-					visited.emplace(t);
-					t = ts.top();
-					if (t == init)
-					{
 						actions.emplace_back(t, Action::Exit);
-						break;
+						subnodes.resize(frame.begin);
+						frames.pop_back();
+						if (frames.empty())
+						{
+							return;
+						}
+
+						t = std::invoke(GetParentFunction, t);
 					}
 				}
+			}
 
-				return actions;
+			// Walks the tree and calls the visitor with (object, action) for every action,
+			// in the same order as Search produces them.
+			// Only the current path and the subnodes of the nodes on that path are stored,
+			// thus the memory used is proportional to the depth of the tree.
+			// The visitor may return a Control, skipped subtrees are never expanded.
+			template<typename T, typename ExtensionFunction_, typename Visitor_>
+			static void Traverse(T* init, ExtensionFunction_ ExtensionFunction, Visitor_ visitor)
+			{
+				DFS::Heap::Traverse(std::allocator_arg, std::allocator<std::byte>(), init,
+									ExtensionFunction, visitor);
 			}
 
-			template<typename T, typename ParentFunction_, typename ExtensionFunction_>
-			static auto Search(T* init, ParentFunction_ GetParentFunction,
-							   ExtensionFunction_ ExtensionFunction)
-				-> std::vector<std::pair<
-					std::conditional_t<
-						std::is_const_v<T> ||
-							std::is_const_v<std::remove_pointer_t<
-								decltype(std::invoke(GetParentFunction, init))>> ||
-							std::is_const_v<std::remove_pointer_t<typename decltype(std::invoke(
-								ExtensionFunction, init))::value_type>>,
-						const T*, T*>,
-					Action>>
-			{
-				using store_T = std::conditional_t<
-					std::is_const_v<T> ||
-						std::is_const_v<std::remove_pointer_t<decltype(std::invoke(
-							GetParentFunction, init))>> ||
-						std::is_const_v<std::remove_pointer_t<typename decltype(std::invoke(
-							ExtensionFunction, init))::value_type>>,
-					const T*, T*>;
+			template<typename Allocator_, typename T, typename ExtensionFunction_,
+					 typename Visitor_>
+			static void Traverse(std::allocator_arg_t, const Allocator_& allocator, T* init,
+								 ExtensionFunction_ ExtensionFunction, Visitor_ visitor)
+			{
+				Buffers<Extension::Store_t<T, ExtensionFunction_>, Allocator_> buffers(allocator);
+				DFS::Heap::Traverse(buffers, init, ExtensionFunction, visitor);
+			}
 
-				if (init == nullptr)
+			// Frame of Traverse, the subnodes of a frame are stored in
+			// subnodes[begin, subnodes.size()), as long as the frame is at the top of the stack.
+			template<typename store_T>
+			struct Frame
+			{
+				store_T object;
+				std::size_t begin;
+				std::size_t next;
+			};
+
+			// Scratch buffers of Traverse, which may be reused between traversals.
+			template<typename store_T, typename Allocator_ = std::allocator<std::byte>>
+			struct Buffers
+			{
+				std::vector<store_T, memory::Allocator::Rebind_t<store_T, Allocator_>> subnodes;
+				std::vector<Frame<store_T>,
+							memory::Allocator::Rebind_t<Frame<store_T>, Allocator_>>
+					frames;
+
+				explicit Buffers(const Allocator_& allocator = Allocator_())
+					: subnodes(memory::Allocator::Rebind<store_T>(allocator)),
+					  frames(memory::Allocator::Rebind<Frame<store_T>>(allocator))
 				{
-					return {};
-				}
-				std::conditional_t<std::is_const_v<T> ||
-									   std::is_const_v<std::remove_pointer_t<decltype(
-										   std::invoke(GetParentFunction, init))>> ||
-									   std::is_const_v<std::remove_pointer_t<typename decltype(
-										   std::invoke(ExtensionFunction, init))::value_type>>,
-								   const T*, T*>
-					parentPointer = std::invoke(GetParentFunction, init);
-				
-				bool complete = false;
-				std::conditional_t<
-					std::is_const_v<T> ||
-						std::is_const_v<std::remove_pointer_t<decltype(std::invoke(
-							GetParentFunction, init))>> ||
-						std::is_const_v<std::remove_pointer_t<typename decltype(std::invoke(
-							ExtensionFunction, init))::value_type>>,
-					const T*, T*>
-					t = init;
-				std::stack<std::pair<std::size_t, std::size_t>> size;
-				std::vector<std::pair<
-					std::conditional_t<
-						std::is_const_v<T> ||
-							std::is_const_v<std::remove_pointer_t<decltype(std::invoke(
-								GetParentFunction, init))>> ||
-							std::is_const_v<std::remove_pointer_t<typename decltype(std::invoke(
-								ExtensionFunction, init))::value_type>>,
-						const T*, T*>,
-					Action>>
-					actions;
+				}
+			};
+
+			// Traverses using the given buffers, their capacity is kept such that repeated
+			// traversals do not allocate.
+			// Upcoming subnodes are prefetched if a Prefetch policy is given.
+			template<typename store_T, typename Allocator_, typename T,
+					 typename ExtensionFunction_, typename Visitor_,
+					 typename Prefetch_ = std::nullptr_t>
+			static void Traverse(Buffers<store_T, Allocator_>& buffers, T* init,
+								 ExtensionFunction_ ExtensionFunction, Visitor_ visitor,
+								 const Prefetch_& prefetch = nullptr)
+			{
+				auto& subnodes = buffers.subnodes;
+				auto& frames = buffers.frames;
+				subnodes.clear();
+				frames.clear();
 
-				size.push({std::invoke(ExtensionFunction, t).size(), 0});
+				const auto subnodeAt = [&subnodes](std::size_t index) { return subnodes[index]; };
 
-				while (!complete)
+				if (init == nullptr)
 				{
-					decltype(std::invoke(ExtensionFunction, t)) subnodes;
-					while (true)
+					return;
+				}
+
+				store_T t = init;
+				while (true)
+				{
+					const auto control = Visitor::Call(visitor, t, Action::Entry);
+					if (control == Control::Stop)
 					{
-						actions.emplace_back(t, Action::Entry);
-						subnodes = std::invoke(ExtensionFunction, t);
-						if (subnodes.empty())
+						return;
+					}
+
+					const auto begin = subnodes.size();
+					if (control != Control::SkipChildren)
+					{
+						Extension::ForEach(ExtensionFunction, t, [&subnodes](store_T subnode) {
+							subnodes.push_back(subnode);
+						});
+						if constexpr (!std::is_null_pointer_v<Prefetch_>)
 						{
-							break;
+							// The first subnode is visited next, its siblings are prefetched.
+							prefetch.Window(begin + 1, subnodes.size(), subnodeAt);
 						}
-
-						t = subnodes[0];
-						size.push({subnodes.size(), 0});
 					}
+					frames.push_back({t, begin, begin});
 
 					while (true)
 					{
-						const auto tOriginal = t;
-						t = std::invoke(GetParentFunction, t);
-						if (t == parentPointer) // Checks if the parent is the parent of the starting node.
+						auto& frame = frames.back();
+						if (frame.next != subnodes.size())
 						{
-							complete = true;
+							if constexpr (!std::is_null_pointer_v<Prefetch_>)
+							{
+								prefetch.Ahead(frame.next, subnodes.size(), subnodeAt);
+							}
+							t = subnodes[frame.next++];
 							break;
 						}
 
-						const auto top = size.top();
-						if (top.first == top.second + 1)
+						if (Visitor::Call(visitor, frame.object, Action::Exit) == Control::Stop)
 						{
-							size.pop();
-							const auto& lastAction = (*--actions.end());
-							if (!(lastAction.first == tOriginal &&
-								  lastAction.second == Action::Exit))
-							{
-								actions.emplace_back(tOriginal, Action::Exit);
-							}
-							actions.emplace_back(t, Action::Exit);
-							if (size.empty())
-							{
-								complete = true;
-								break;
-							}
-							continue;
+							return;
 						}
-						// otherwise it is covered via parent logic
-						if (std::invoke(ExtensionFunction, tOriginal).empty())
+						subnodes.resize(frame.begin);
+						frames.pop_back();
+						if (frames.empty())
 						{
-							actions.emplace_back(tOriginal, Action::Exit);
+							return;
 						}
-
-						auto tmp1 = ++size.top().second;
-						auto tmp2 = std::invoke(ExtensionFunction, t);
-						t = tmp2[tmp1];
-						break;
 					}
 				}
-
-				if (actions.size() == 1)
-				{
-					actions.emplace_back(init, Action::Exit);
-				}
-
-				return actions;
 			}
 		};
 
 		// Algorithms using Stack approach
-		// Can cause stack overflows on large inputs
+		// Recurses up to a depth limit, deeper subtrees are searched using the Heap approach.
+		// Thus shallow trees are searched recursively, while deep trees cannot overflow the stack.
 		struct Stack
 		{
+			static constexpr std::size_t defaultRecursionLimit = 1024;
+
 			template<typename T, typename ExtensionFunction_>
 			static auto Search(T* init, ExtensionFunction_ ExtensionFunction)
 			{
-				using store_T = std::conditional_t<
-					std::is_const_v<T> ||
-						std::is_const_v<std::remove_pointer_t<typename decltype(std::invoke(
-							ExtensionFunction, init))::value_type>>,
-					const T*, T*>;
+				return DFS::Stack::Search(std::allocator_arg, std::allocator<std::byte>(), init,
+										  ExtensionFunction);
+			}
 
-				if (init == nullptr)
-				{
-					return std::vector<std::pair<
-						std::conditional_t<
-							std::is_const_v<T> ||
-								std::is_const_v<std::remove_pointer_t<typename decltype(std::invoke(
-									ExtensionFunction, init))::value_type>>,
-							const T*, T*>,
-						Action>>{};
-				}
-
-				std::vector<std::pair<
-					std::conditional_t<
-						std::is_const_v<T> ||
-							std::is_const_v<std::remove_pointer_t<typename decltype(std::invoke(
-								ExtensionFunction, init))::value_type>>,
-						const T*, T*>,
-					Action>>
-					actions;
+			// Recurses at most recursionLimit levels deep.
+			template<typename T, typename ExtensionFunction_>
+			static auto Search(T* init, ExtensionFunction_ ExtensionFunction,
+							   std::size_t recursionLimit)
+			{
+				Actions_t<Extension::Store_t<T, ExtensionFunction_>> actions;
+				DFS::Stack::SearchLogic(init, ExtensionFunction, actions, recursionLimit);
+
+				return actions;
+			}
 
+			// Reserves the output at once, see SizeHint.
+			template<typename T, typename ExtensionFunction_>
+			static auto Search(T* init, ExtensionFunction_ ExtensionFunction, SizeHint hint)
+			{
+				Actions_t<Extension::Store_t<T, ExtensionFunction_>> actions;
+				hint.Reserve(actions, init, ExtensionFunction);
 				DFS::Stack::SearchLogic(init, ExtensionFunction, actions);
 
 				return actions;
 			}
 
-			template<typename T, typename ExtensionFunction_>
-			static void SearchLogic(
-				T* init, ExtensionFunction_ ExtensionFunction,
-				std::vector<std::pair<
-					std::conditional_t<
-						std::is_const_v<T> ||
-							std::is_const_v<std::remove_pointer_t<typename decltype(std::invoke(
-								ExtensionFunction, init))::value_type>>,
-						const T*, T*>,
-					Action>>& actions)
+			template<typename Allocator_, typename T, typename ExtensionFunction_>
+			static auto Search(std::allocator_arg_t, const Allocator_& allocator, T* init,
+							   ExtensionFunction_ ExtensionFunction)
 			{
-				if (init == nullptr)
+				using store_T = Extension::Store_t<T, ExtensionFunction_>;
+
+				Actions_t<store_T, Allocator_> actions(
+					memory::Allocator::Rebind<std::pair<store_T, Action>>(allocator));
+
+				DFS::Stack::SearchLogic(init, ExtensionFunction, actions);
+
+				return actions;
+			}
+
+			template<typename T, typename ExtensionFunction_, typename VectorAllocator_>
+			static void
+			SearchLogic(T* init, ExtensionFunction_ ExtensionFunction,
+						std::vector<std::pair<Extension::Store_t<T, ExtensionFunction_>, Action>,
+									VectorAllocator_>& actions,
+						std::size_t recursionLimit = defaultRecursionLimit)
+			{
+				DFS::Stack::Recurse(init, ExtensionFunction, actions, recursionLimit);
+			}
+
+		private:
+			// The extension function is passed by reference, thus frames do not copy it.
+			template<typename T, typename ExtensionFunction_, typename Actions_>
+			static void Recurse(T* object, ExtensionFunction_& ExtensionFunction, Actions_& actions,
+								std::size_t remaining)
+			{
+				if (object == nullptr)
 				{
 					return;
 				}
 
-				actions.emplace_back(init, Action::Entry);
-
-				auto subnodes = std::invoke(ExtensionFunction, init);
-				for (auto subnode : subnodes)
+				if (remaining == 0)
 				{
-					SearchLogic(subnode, ExtensionFunction, actions);
+					DFS::Heap::Search(actions, object, ExtensionFunction);
+					return;
 				}
 
-				actions.emplace_back(init, Action::Exit);
+				actions.emplace_back(object, Action::Entry);
+
+				Extension::ForEach(ExtensionFunction, object, [&](auto subnode) {
+					DFS::Stack::Recurse(subnode, ExtensionFunction, actions, remaining - 1);
+				});
+
+				actions.emplace_back(object, Action::Exit);
 			}
 		};
 
@@ -311,48 +489,402 @@ namespace deamer::algorithm::tree
 			return DFS::Heap::Search(std::forward<Args>(args)...);
 		}
 
-		// Automatically execute entry and exit functions after search.
-		struct Execute
+		// Updates a stored DFS order after subtrees of the tree have been edited.
+		// The extension function is only called for the modified subtrees, the remainder of the
+		// order is copied over in a single scan.
+		struct Incremental
 		{
-			template<typename T, typename EntryAction_, typename ExitAction_>
-			static void ActionExecution(std::vector<std::pair<T*, Action>> actions,
-										EntryAction_ EntryAction, ExitAction_ ExitAction)
+			// Replaces the actions of every modified subtree with a new search from its root.
+			// Roots are required to be still part of the tree at the same position, e.g. if
+			// subnodes are added or removed, the parent of these subnodes is a modified root.
+			// Roots that are not part of the actions are ignored, as are roots within another
+			// modified subtree.
+			template<typename store_T, typename Allocator_, typename Roots_,
+					 typename ExtensionFunction_>
+			static void Update(std::vector<std::pair<store_T, Action>, Allocator_>& actions,
+							   const Roots_& modifiedRoots, ExtensionFunction_ ExtensionFunction)
 			{
-				for (const auto& [object, action] : actions)
+				std::vector<store_T> roots(std::begin(modifiedRoots), std::end(modifiedRoots));
+				std::sort(roots.begin(), roots.end(), std::less<store_T>());
+
+				// Every node has a single exit, thus the exit of a root is the first exit
+				// following its entry that has the root as object.
+				std::vector<std::pair<std::size_t, std::size_t>> ranges;
+				for (std::size_t i = 0; i < actions.size(); i++)
 				{
-					switch (action)
+					const auto [object, action] = actions[i];
+					if (action != Action::Entry ||
+						!std::binary_search(roots.begin(), roots.end(), object,
+											std::less<store_T>()))
 					{
-					case Action::Entry: {
-						EntryAction(object);
-						break;
+						continue;
 					}
-					case Action::Exit: {
-						ExitAction(object);
-						break;
+
+					auto exit = i + 1;
+					while (actions[exit].first != object || actions[exit].second != Action::Exit)
+					{
+						exit++;
 					}
+					ranges.emplace_back(i, exit + 1);
+					i = exit;
+				}
+
+				if (ranges.empty())
+				{
+					return;
+				}
+
+				std::vector<std::pair<store_T, Action>, Allocator_> updated(
+					actions.get_allocator());
+				updated.reserve(actions.size());
+				std::size_t copied = 0;
+				for (const auto& [begin, end] : ranges)
+				{
+					updated.insert(updated.end(), actions.begin() + copied,
+								   actions.begin() + begin);
+					DFS::Heap::Search(updated, actions[begin].first, ExtensionFunction);
+					copied = end;
+				}
+				updated.insert(updated.end(), actions.begin() + copied, actions.end());
+
+				actions = std::move(updated);
+			}
+		};
+
+		/*!	\class Context
+		 *
+		 *	\brief Owns the buffers of a search, such that repeated searches reuse their capacity.
+		 *
+		 *	\details Once the buffers have grown to the size of the largest tree searched, searches
+		 *	using the context do not allocate. The actions returned by Search are stored in the
+		 *	context, they are valid until the next search using the same context.
+		 *
+		 *	T is the type of the objects, e.g. const Node if the extension function gives const
+		 *	subnodes.
+		 */
+		template<typename T, typename Allocator_ = std::allocator<std::byte>>
+		class Context
+		{
+		private:
+			Heap::Buffers<T*, Allocator_> buffers;
+			Actions_t<T*, Allocator_> actions;
+
+		public:
+			explicit Context(const Allocator_& allocator = Allocator_())
+				: buffers(allocator),
+				  actions(memory::Allocator::Rebind<std::pair<T*, Action>>(allocator))
+			{
+			}
+
+			template<typename ExtensionFunction_>
+			const Actions_t<T*, Allocator_>& Search(T* init, ExtensionFunction_ ExtensionFunction)
+			{
+				actions.clear();
+				DFS::Heap::Traverse(buffers, init, ExtensionFunction,
+									[this](T* object, Action action) {
+										actions.emplace_back(object, action);
+									});
+
+				return actions;
+			}
+
+			template<typename ExtensionFunction_, typename Visitor_>
+			void Traverse(T* init, ExtensionFunction_ ExtensionFunction, Visitor_ visitor)
+			{
+				DFS::Heap::Traverse(buffers, init, ExtensionFunction, visitor);
+			}
+
+			// Equal to Execute::Streaming::Search.
+			template<typename ExtensionFunction_, typename EntryAction_, typename ExitAction_>
+			void Execute(T* init, ExtensionFunction_ ExtensionFunction, EntryAction_ EntryAction,
+						 ExitAction_ ExitAction)
+			{
+				DFS::Heap::Traverse(buffers, init, ExtensionFunction,
+									[&](T* object, Action action) {
+										if (action == Action::Entry)
+										{
+											return Visitor::Call(EntryAction, object);
+										}
+										return Visitor::Call(ExitAction, object);
+									});
+			}
+		};
+
+		/*!	\class LazyRange
+		 *
+		 *	\brief Input range yielding the same (object, action) pairs as Search, on demand.
+		 *
+		 *	\details The subnodes of a node are only requested when advancing past its entry.
+		 *	Thus stopping early, e.g. via break or std::find_if, does not visit the rest of the
+		 *	tree.
+		 *	Copying an iterator copies the current path.
+		 */
+		template<typename T, typename ExtensionFunction_>
+		class LazyRange
+		{
+		public:
+			class iterator
+			{
+			public:
+				// Yields the pairs by value, as they are not stored beyond the current one.
+				using iterator_category = std::input_iterator_tag;
+				using value_type = std::pair<T*, Action>;
+				using difference_type = std::ptrdiff_t;
+				using pointer = void;
+				using reference = value_type;
+
+			private:
+				struct Frame
+				{
+					T* object;
+					std::size_t begin;
+					std::size_t next;
+				};
+
+				std::shared_ptr<const ExtensionFunction_> extensionFunction;
+				std::vector<T*> subnodes;
+				std::vector<Frame> frames;
+				value_type current{nullptr, Action::Entry};
+
+			public:
+				iterator() = default;
+
+				iterator(T* init, std::shared_ptr<const ExtensionFunction_> extensionFunction_)
+					: extensionFunction(init == nullptr ? nullptr : std::move(extensionFunction_)),
+					  current(init, Action::Entry)
+				{
+				}
+
+				reference operator*() const
+				{
+					return current;
+				}
+
+				iterator& operator++()
+				{
+					Advance();
+					return *this;
+				}
+
+				iterator operator++(int)
+				{
+					auto tmp = *this;
+					Advance();
+					return tmp;
+				}
+
+				// Every node has a single entry and exit, thus the current action identifies the
+				// position.
+				bool operator==(const iterator& rhs) const
+				{
+					if (extensionFunction == nullptr || rhs.extensionFunction == nullptr)
+					{
+						return extensionFunction == rhs.extensionFunction;
+					}
+
+					return current == rhs.current;
+				}
+
+				bool operator!=(const iterator& rhs) const
+				{
+					return !(*this == rhs);
+				}
+
+			private:
+				void Advance()
+				{
+					if (current.second == Action::Entry)
+					{
+						const auto begin = subnodes.size();
+						Extension::ForEach(*extensionFunction, current.first,
+										   [this](T* subnode) { subnodes.push_back(subnode); });
+						frames.push_back({current.first, begin, begin});
+					}
+
+					// The exit of the initial object has been reached.
+					if (frames.empty())
+					{
+						extensionFunction = nullptr;
+						subnodes.clear();
+						return;
+					}
+
+					auto& frame = frames.back();
+					if (frame.next != subnodes.size())
+					{
+						current = {subnodes[frame.next++], Action::Entry};
+						return;
 					}
+
+					current = {frame.object, Action::Exit};
+					subnodes.resize(frame.begin);
+					frames.pop_back();
 				}
+			};
+
+			LazyRange(T* init_, ExtensionFunction_ ExtensionFunction)
+				: init(init_),
+				  extensionFunction(std::make_shared<const ExtensionFunction_>(ExtensionFunction))
+			{
 			}
 
-			template<typename T, typename EntryAction_, typename ExitAction_, typename T_Action>
-			static void ActionExecution(std::vector<std::pair<T*, Action>> actions,
-										EntryAction_ EntryAction, ExitAction_ ExitAction,
-										T_Action actionObject)
+			iterator begin() const
 			{
-				for (const auto& [object, action] : actions)
+				return iterator(init, extensionFunction);
+			}
+
+			iterator end() const
+			{
+				return iterator();
+			}
+
+		private:
+			T* init;
+			std::shared_ptr<const ExtensionFunction_> extensionFunction;
+		};
+
+		template<typename T, typename ExtensionFunction_>
+		static auto Range(T* init, ExtensionFunction_ ExtensionFunction)
+		{
+			using store_T = Extension::Store_t<T, ExtensionFunction_>;
+
+			return LazyRange<std::remove_pointer_t<store_T>, ExtensionFunction_>(init,
+																				 ExtensionFunction);
+		}
+
+		// Executes the entry and exit functions for precomputed actions, such as the output of
+		// Search or SearchPacked. The actions are not copied, thus a single search can be replayed
+		// by any number of passes.
+		// The functions may return a Control:
+		// - SkipChildren: returned on entry, the actions up to the exit of the object are skipped.
+		// The exit itself is still executed.
+		// - Stop: ends the replay.
+		template<typename Actions_, typename EntryAction_, typename ExitAction_>
+		static void Replay(const Actions_& actions, EntryAction_ EntryAction,
+						   ExitAction_ ExitAction)
+		{
+			// Depth within a skipped subtree, the subtree ends when it returns to zero.
+			std::size_t skipped = 0;
+			for (const auto& [object, action] : actions)
+			{
+				if (skipped != 0)
 				{
-					switch (action)
+					skipped = action == Action::Entry ? skipped + 1 : skipped - 1;
+					if (skipped != 0)
 					{
-					case Action::Entry: {
-						std::invoke(EntryAction, actionObject, object);
-						break;
+						continue;
 					}
-					case Action::Exit: {
-						std::invoke(ExitAction, actionObject, object);
-						break;
+				}
+
+				switch (action)
+				{
+				case Action::Entry: {
+					const auto control = Visitor::Call(EntryAction, object);
+					if (control == Control::Stop)
+					{
+						return;
+					}
+					if (control == Control::SkipChildren)
+					{
+						skipped = 1;
 					}
+					break;
+				}
+				case Action::Exit: {
+					if (Visitor::Call(ExitAction, object) == Control::Stop)
+					{
+						return;
 					}
+					break;
 				}
+				}
+			}
+		}
+
+		template<typename Actions_, typename EntryAction_, typename ExitAction_, typename T_Action>
+		static void Replay(const Actions_& actions, EntryAction_ EntryAction,
+						   ExitAction_ ExitAction, T_Action actionObject)
+		{
+			DFS::Replay(
+				actions,
+				[&](auto object) { return Visitor::Call(EntryAction, actionObject, object); },
+				[&](auto object) { return Visitor::Call(ExitAction, actionObject, object); });
+		}
+
+		// Computes a value per subtree, bottom-up, and returns the value of the tree of init.
+		// The value of a node without subnodes is LeafFunction(node), the value of other nodes is
+		// CombineFunction(node, first, last), where [first, last) are the values of its subnodes
+		// in order.
+		// Values are passed to the parent on a stack, thus only the values of the subnodes of
+		// the nodes on the current path are stored. If init is nullptr, nothing is returned.
+		template<typename T, typename ExtensionFunction_, typename LeafFunction_,
+				 typename CombineFunction_>
+		static auto Fold(T* init, ExtensionFunction_ ExtensionFunction, LeafFunction_ LeafFunction,
+						 CombineFunction_ CombineFunction)
+		{
+			return DFS::Fold(std::allocator_arg, std::allocator<std::byte>(), init,
+							 ExtensionFunction, LeafFunction, CombineFunction);
+		}
+
+		template<typename Allocator_, typename T, typename ExtensionFunction_,
+				 typename LeafFunction_, typename CombineFunction_>
+		static auto Fold(std::allocator_arg_t, const Allocator_& allocator, T* init,
+						 ExtensionFunction_ ExtensionFunction, LeafFunction_ LeafFunction,
+						 CombineFunction_ CombineFunction)
+		{
+			using store_T = Extension::Store_t<T, ExtensionFunction_>;
+			using result_T = std::decay_t<std::invoke_result_t<LeafFunction_&, store_T>>;
+
+			// Values of the finished subtrees, and per node on the path the index of the value of
+			// its first subnode.
+			std::vector<result_T, memory::Allocator::Rebind_t<result_T, Allocator_>> values(
+				memory::Allocator::Rebind<result_T>(allocator));
+			std::vector<std::size_t, memory::Allocator::Rebind_t<std::size_t, Allocator_>> begins(
+				memory::Allocator::Rebind<std::size_t>(allocator));
+
+			DFS::Heap::Traverse(
+				std::allocator_arg, allocator, init, ExtensionFunction,
+				[&](store_T object, Action action) {
+					if (action == Action::Entry)
+					{
+						begins.push_back(values.size());
+						return;
+					}
+
+					const auto begin = values.begin() + begins.back();
+					begins.pop_back();
+					if (begin == values.end())
+					{
+						values.push_back(std::invoke(LeafFunction, object));
+						return;
+					}
+
+					result_T value = std::invoke(CombineFunction, object, begin, values.end());
+					values.erase(begin, values.end());
+					values.push_back(std::move(value));
+				});
+
+			return values.empty() ? std::optional<result_T>()
+								  : std::optional<result_T>(std::move(values.back()));
+		}
+
+		// Automatically execute entry and exit functions after search.
+		struct Execute
+		{
+			// Equal to DFS::Replay, the actions are not copied.
+			template<typename Actions_, typename EntryAction_, typename ExitAction_>
+			static void ActionExecution(const Actions_& actions, EntryAction_ EntryAction,
+										ExitAction_ ExitAction)
+			{
+				DFS::Replay(actions, EntryAction, ExitAction);
+			}
+
+			template<typename Actions_, typename EntryAction_, typename ExitAction_,
+					 typename T_Action>
+			static void ActionExecution(const Actions_& actions, EntryAction_ EntryAction,
+										ExitAction_ ExitAction, T_Action actionObject)
+			{
+				DFS::Replay(actions, EntryAction, ExitAction, actionObject);
 			}
 
 			struct Heap
@@ -362,8 +894,8 @@ namespace deamer::algorithm::tree
 				static void Search(T* init, ExtensionFunction_ ExtensionFunction,
 								   EntryAction_ EntryAction, ExitAction_ ExitAction)
 				{
-					ActionExecution(DFS::Heap::Search(init, ExtensionFunction), EntryAction,
-									ExitAction);
+					DFS::Execute::Streaming::Search(init, ExtensionFunction, EntryAction,
+													ExitAction);
 				}
 
 				template<
@@ -379,8 +911,32 @@ namespace deamer::algorithm::tree
 								   EntryAction_ EntryAction, ExitAction_ ExitAction,
 								   T_Action actionObject)
 				{
-					ActionExecution(DFS::Heap::Search(init, ExtensionFunction), EntryAction,
-									ExitAction, actionObject);
+					DFS::Execute::Streaming::Search(init, ExtensionFunction, EntryAction,
+													ExitAction, actionObject);
+				}
+
+				template<typename Allocator_, typename T, typename ExtensionFunction_,
+						 typename EntryAction_, typename ExitAction_>
+				static void Search(std::allocator_arg_t, const Allocator_& allocator, T* init,
+								   ExtensionFunction_ ExtensionFunction, EntryAction_ EntryAction,
+								   ExitAction_ ExitAction)
+				{
+					DFS::Execute::Streaming::Search(std::allocator_arg, allocator, init,
+													ExtensionFunction, EntryAction, ExitAction);
+				}
+
+				// An action object is not callable with a node, unlike the exit function of the
+				// overload taking a parent function.
+				template<typename Allocator_, typename T, typename ExtensionFunction_,
+						 typename EntryAction_, typename ExitAction_, typename T_Action,
+						 std::enable_if_t<!std::is_invocable_v<T_Action&, T*>, bool> = true>
+				static void Search(std::allocator_arg_t, const Allocator_& allocator, T* init,
+								   ExtensionFunction_ ExtensionFunction, EntryAction_ EntryAction,
+								   ExitAction_ ExitAction, T_Action actionObject)
+				{
+					DFS::Execute::Streaming::Search(std::allocator_arg, allocator, init,
+													ExtensionFunction, EntryAction, ExitAction,
+													actionObject);
 				}
 
 				template<typename T, typename ParentFunction_, typename ExtensionFunction_,
@@ -414,6 +970,102 @@ namespace deamer::algorithm::tree
 					ActionExecution(DFS::Heap::Search(init, GetParentFunction, ExtensionFunction),
 									EntryAction, ExitAction, actionObject);
 				}
+
+				template<typename Allocator_, typename T, typename ParentFunction_,
+						 typename ExtensionFunction_, typename EntryAction_, typename ExitAction_,
+						 std::enable_if_t<std::is_invocable_v<ExitAction_&, T*>, bool> = true>
+				static void Search(std::allocator_arg_t, const Allocator_& allocator, T* init,
+								   ParentFunction_ GetParentFunction,
+								   ExtensionFunction_ ExtensionFunction, EntryAction_ EntryAction,
+								   ExitAction_ ExitAction)
+				{
+					ActionExecution(DFS::Heap::Search(std::allocator_arg, allocator, init,
+													  GetParentFunction, ExtensionFunction),
+									EntryAction, ExitAction);
+				}
+
+				template<typename Allocator_, typename T, typename ParentFunction_,
+						 typename ExtensionFunction_, typename EntryAction_, typename ExitAction_,
+						 typename T_Action>
+				static void Search(std::allocator_arg_t, const Allocator_& allocator, T* init,
+								   ParentFunction_ GetParentFunction,
+								   ExtensionFunction_ ExtensionFunction, EntryAction_ EntryAction,
+								   ExitAction_ ExitAction, T_Action actionObject)
+				{
+					ActionExecution(DFS::Heap::Search(std::allocator_arg, allocator, init,
+													  GetParentFunction, ExtensionFunction),
+									EntryAction, ExitAction, actionObject);
+				}
+			};
+
+			// Executes the entry and exit functions during the search itself.
+			// The actions are not materialized, the memory used is proportional to the depth of
+			// the tree.
+			// The entry and exit functions may return a Control to skip subtrees or stop.
+			struct Streaming
+			{
+				template<typename T, typename ExtensionFunction_, typename EntryAction_,
+						 typename ExitAction_>
+				static void Search(T* init, ExtensionFunction_ ExtensionFunction,
+								   EntryAction_ EntryAction, ExitAction_ ExitAction)
+				{
+					Streaming::Search(std::allocator_arg, std::allocator<std::byte>(), init,
+									  ExtensionFunction, EntryAction, ExitAction);
+				}
+
+				template<typename T, typename ExtensionFunction_, typename EntryAction_,
+						 typename ExitAction_, typename T_Action>
+				static void Search(T* init, ExtensionFunction_ ExtensionFunction,
+								   EntryAction_ EntryAction, ExitAction_ ExitAction,
+								   T_Action actionObject)
+				{
+					Streaming::Search(std::allocator_arg, std::allocator<std::byte>(), init,
+									  ExtensionFunction, EntryAction, ExitAction, actionObject);
+				}
+
+				template<typename Allocator_, typename T, typename ExtensionFunction_,
+						 typename EntryAction_, typename ExitAction_>
+				static void Search(std::allocator_arg_t, const Allocator_& allocator, T* init,
+								   ExtensionFunction_ ExtensionFunction, EntryAction_ EntryAction,
+								   ExitAction_ ExitAction)
+				{
+					DFS::Heap::Traverse(std::allocator_arg, allocator, init, ExtensionFunction,
+										[&](auto object, Action action) {
+											switch (action)
+											{
+											case Action::Entry: {
+												return Visitor::Call(EntryAction, object);
+											}
+											case Action::Exit: {
+												return Visitor::Call(ExitAction, object);
+											}
+											}
+											return Control::Continue;
+										});
+				}
+
+				template<typename Allocator_, typename T, typename ExtensionFunction_,
+						 typename EntryAction_, typename ExitAction_, typename T_Action>
+				static void Search(std::allocator_arg_t, const Allocator_& allocator, T* init,
+								   ExtensionFunction_ ExtensionFunction, EntryAction_ EntryAction,
+								   ExitAction_ ExitAction, T_Action actionObject)
+				{
+					DFS::Heap::Traverse(std::allocator_arg, allocator, init, ExtensionFunction,
+										[&](auto object, Action action) {
+											switch (action)
+											{
+											case Action::Entry: {
+												return Visitor::Call(EntryAction, actionObject,
+																	 object);
+											}
+											case Action::Exit: {
+												return Visitor::Call(ExitAction, actionObject,
+																	 object);
+											}
+											}
+											return Control::Continue;
+										});
+				}
 			};
 
 			struct Stack
@@ -436,6 +1088,28 @@ namespace deamer::algorithm::tree
 					DFS::Execute::ActionExecution(DFS::Stack::Search(init, ExtensionFunction),
 												  EntryAction, ExitAction, actionObject);
 				}
+
+				template<typename Allocator_, typename T, typename ExtensionFunction_,
+						 typename EntryAction_, typename ExitAction_>
+				static void Search(std::allocator_arg_t, const Allocator_& allocator, T* init,
+								   ExtensionFunction_ ExtensionFunction, EntryAction_ EntryAction,
+								   ExitAction_ ExitAction)
+				{
+					DFS::Execute::ActionExecution(
+						DFS::Stack::Search(std::allocator_arg, allocator, init, ExtensionFunction),
+						EntryAction, ExitAction);
+				}
+
+				template<typename Allocator_, typename T, typename ExtensionFunction_,
+						 typename EntryAction_, typename ExitAction_, typename T_Action>
+				static void Search(std::allocator_arg_t, const Allocator_& allocator, T* init,
+								   ExtensionFunction_ ExtensionFunction, EntryAction_ EntryAction,
+								   ExitAction_ ExitAction, T_Action actionObject)
+				{
+					DFS::Execute::ActionExecution(
+						DFS::Stack::Search(std::allocator_arg, allocator, init, ExtensionFunction),
+						EntryAction, ExitAction, actionObject);
+				}
 			};
 
 			template<typename... Args>
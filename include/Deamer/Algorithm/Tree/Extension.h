@@ -0,0 +1,266 @@
+#ifndef DEAMER_ALGORITHM_TREE_EXTENSION_H
+#define DEAMER_ALGORITHM_TREE_EXTENSION_H
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace deamer::algorithm::tree
+{
+	/*!	\class ChildTraits
+	 *
+	 *	\brief Specialize for node types having a fixed number of subnodes, to traverse them using
+	 *	Extension::Children.
+	 *
+	 *	\details Example specialization:
+	 *	```
+	 *	template<>
+	 *	struct ChildTraits<BinaryNode>
+	 *	{
+	 *		static constexpr std::size_t arity = 2;
+	 *
+	 *		template<std::size_t I>
+	 *		static BinaryNode* Get(const BinaryNode& node)
+	 *		{
+	 *			return I == 0 ? node.left : node.right;
+	 *		}
+	 *	};
+	 *	```
+	 *	Subnodes that are nullptr are skipped, thus optional slots can be empty.
+	 */
+	template<typename T>
+	struct ChildTraits;
+
+	/*!	\class Extension
+	 *
+	 *	\brief Struct containing meta functions to retrieve the subnodes of a node, independent of
+	 *	the form of the extension function.
+	 *
+	 *	\details The following forms of extension functions are supported:
+	 *	- Returning a range, i.e. any type supporting std::begin and std::end. Such as a container
+	 *	by value or by reference, or a view such as std::span.
+	 *	- Returning a std::pair of iterators.
+	 *	- Accepting a Sink as second argument, to which every subnode is passed. The return value is
+	 *	ignored.
+	 *	- Extension::Children, using the ChildTraits of the node type.
+	 *
+	 *	Subnodes returned in a std::array, or given by ChildTraits, are visited in an unrolled
+	 *	loop. These fixed slots may be nullptr, such subnodes are skipped.
+	 *
+	 *	Only returning a container by value requires an allocation per node, the other forms allow
+	 *	nodes storing their subnodes to be extended without any allocation.
+	 */
+	struct Extension
+	{
+		/*!	\class Sink
+		 *
+		 *	\brief Receives the subnodes of a node, from an extension function accepting a sink.
+		 *
+		 *	\details Example extension function:
+		 *	```
+		 *	void Node::GetSubNodes(Extension::Sink<const Node>& sink) const
+		 *	{
+		 *		sink(left);
+		 *		sink(right);
+		 *	}
+		 *	```
+		 */
+		template<typename T>
+		class Sink
+		{
+		public:
+			// Excludes sinks, which would otherwise be wrapped instead of copied.
+			template<typename Function_, typename = std::enable_if_t<
+											 !std::is_same_v<std::remove_cv_t<Function_>, Sink>>>
+			explicit Sink(Function_& function)
+				: context(&function),
+				  push([](void* context_, T* subnode) {
+					  (*static_cast<Function_*>(context_))(subnode);
+				  })
+			{
+			}
+
+			void operator()(T* subnode)
+			{
+				push(context, subnode);
+			}
+
+			void push_back(T* subnode)
+			{
+				push(context, subnode);
+			}
+
+		private:
+			void* context;
+			void (*push)(void*, T*);
+		};
+
+		// Extension function using the ChildTraits of the node type.
+		struct Children
+		{
+		};
+
+		template<typename T>
+		struct IsArray : std::false_type
+		{
+		};
+
+		template<typename T, std::size_t N>
+		struct IsArray<std::array<T, N>> : std::true_type
+		{
+		};
+
+		template<typename T>
+		struct IsIteratorPair : std::false_type
+		{
+		};
+
+		template<typename Iterator_>
+		struct IsIteratorPair<std::pair<Iterator_, Iterator_>> : std::true_type
+		{
+		};
+
+		// Deduces the type of the subnodes, which is the type of the sink if the extension function
+		// accepts a sink.
+		template<typename ExtensionFunction_, typename T, typename = void>
+		struct Subnode
+		{
+		};
+
+		template<typename ExtensionFunction_, typename T>
+		struct Subnode<
+			ExtensionFunction_, T,
+			std::enable_if_t<std::is_invocable_v<ExtensionFunction_&, T*,
+												 Sink<std::remove_const_t<T>>&>>>
+		{
+			using type = std::remove_const_t<T>*;
+		};
+
+		template<typename ExtensionFunction_, typename T>
+		struct Subnode<
+			ExtensionFunction_, T,
+			std::enable_if_t<
+				!std::is_invocable_v<ExtensionFunction_&, T*, Sink<std::remove_const_t<T>>&> &&
+				std::is_invocable_v<ExtensionFunction_&, T*, Sink<const T>&>>>
+		{
+			using type = const T*;
+		};
+
+		template<typename ExtensionFunction_, typename T>
+		struct Subnode<ExtensionFunction_, T,
+					   std::enable_if_t<IsIteratorPair<std::remove_cv_t<std::remove_reference_t<
+						   std::invoke_result_t<ExtensionFunction_&, T*>>>>::value>>
+		{
+			using type = std::decay_t<decltype(*std::declval<typename std::remove_reference_t<
+												   std::invoke_result_t<ExtensionFunction_&, T*>>::
+																 first_type>())>;
+		};
+
+		template<typename ExtensionFunction_, typename T>
+		struct Subnode<ExtensionFunction_, T,
+					   std::enable_if_t<!IsIteratorPair<std::remove_cv_t<std::remove_reference_t<
+											std::invoke_result_t<ExtensionFunction_&, T*>>>>::value,
+										std::void_t<decltype(std::begin(
+											std::declval<std::invoke_result_t<
+												ExtensionFunction_&, T*>&>()))>>>
+		{
+			using type = std::decay_t<decltype(*std::begin(
+				std::declval<std::invoke_result_t<ExtensionFunction_&, T*>&>()))>;
+		};
+
+		template<typename ExtensionFunction_, typename T>
+		struct Subnode<
+			ExtensionFunction_, T,
+			std::enable_if_t<std::is_same_v<std::remove_const_t<ExtensionFunction_>, Children>>>
+		{
+			static_assert(ChildTraits<std::remove_const_t<T>>::arity > 0,
+						  "Nodes without subnodes have no subnode type");
+
+			using type = std::decay_t<decltype(ChildTraits<std::remove_const_t<T>>::template Get<0>(
+				std::declval<T&>()))>;
+		};
+
+		template<typename ExtensionFunction_, typename T>
+		using Subnode_t = typename Subnode<ExtensionFunction_, T>::type;
+
+		// Pointer type able to store both the given object and its subnodes.
+		template<typename T, typename ExtensionFunction_>
+		using Store_t = std::conditional_t<
+			std::is_const_v<T> ||
+				std::is_const_v<std::remove_pointer_t<Subnode_t<ExtensionFunction_, T>>>,
+			const T*, T*>;
+
+		// Calls the function with every subnode of the object, in order.
+		template<typename ExtensionFunction_, typename T, typename Function_>
+		static void ForEach(ExtensionFunction_& ExtensionFunction, T* object, Function_&& function)
+		{
+			using subnode_T = Subnode_t<ExtensionFunction_, T>;
+
+			if constexpr (std::is_same_v<std::remove_const_t<ExtensionFunction_>, Children>)
+			{
+				using traits_T = ChildTraits<std::remove_const_t<T>>;
+				Extension::Unroll(
+					[object](auto index) {
+						return traits_T::template Get<decltype(index)::value>(*object);
+					},
+					function, std::make_index_sequence<traits_T::arity>());
+			}
+			else if constexpr (std::is_invocable_v<ExtensionFunction_&, T*,
+											  Sink<std::remove_pointer_t<subnode_T>>&>)
+			{
+				auto push = [&function](subnode_T subnode) { function(subnode); };
+				Sink<std::remove_pointer_t<subnode_T>> sink(push);
+				std::invoke(ExtensionFunction, object, sink);
+			}
+			else
+			{
+				auto&& subnodes = std::invoke(ExtensionFunction, object);
+				using result_T = std::remove_cv_t<std::remove_reference_t<decltype(subnodes)>>;
+				if constexpr (IsArray<result_T>::value)
+				{
+					Extension::Unroll(
+						[&subnodes](auto index) {
+							return std::get<decltype(index)::value>(subnodes);
+						},
+						function, std::make_index_sequence<std::tuple_size_v<result_T>>());
+				}
+				else if constexpr (IsIteratorPair<result_T>::value)
+				{
+					for (auto i = subnodes.first; i != subnodes.second; ++i)
+					{
+						function(*i);
+					}
+				}
+				else
+				{
+					for (auto&& subnode : subnodes)
+					{
+						function(subnode);
+					}
+				}
+			}
+		}
+
+	private:
+		// Calls the function with the subnode in every slot that is not nullptr.
+		template<typename Slot_, typename Function_, std::size_t... I>
+		static void Unroll(Slot_&& slot, Function_& function, std::index_sequence<I...>)
+		{
+			(Extension::Visit(slot(std::integral_constant<std::size_t, I>()), function), ...);
+		}
+
+		template<typename Subnode_, typename Function_>
+		static void Visit(Subnode_ subnode, Function_& function)
+		{
+			if (subnode != nullptr)
+			{
+				function(subnode);
+			}
+		}
+	};
+}
+
+#endif // DEAMER_ALGORITHM_TREE_EXTENSION_H
@@ -0,0 +1,204 @@
+#ifndef DEAMER_ALGORITHM_TREE_FLATTREE_H
+#define DEAMER_ALGORITHM_TREE_FLATTREE_H
+
+#include "Deamer/Algorithm/Tree/DFS.h"
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace deamer::algorithm::tree
+{
+	/*!	\class FlatTree
+	 *
+	 *	\brief Snapshot of a tree, flattened in pre-order into contiguous arrays.
+	 *
+	 *	\details The snapshot is built using a single DFS. Nodes are referred to by their index in
+	 *	pre-order, for every node the following is stored:
+	 *	- the end of its subtree, the subtree of node i is [i, SubtreeEnd(i))
+	 *	- its parent, depth, first child and next sibling
+	 *
+	 *	Traversals and subtree queries on the snapshot are scans over these arrays, they do not
+	 *	call the extension function. The snapshot is not updated if the tree changes.
+	 */
+	template<typename T>
+	class FlatTree
+	{
+	public:
+		static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+	private:
+		std::vector<T*> objects;
+		std::vector<std::size_t> subtreeEnd;
+		std::vector<std::size_t> parent;
+		std::vector<std::size_t> depth;
+		std::vector<std::size_t> firstChild;
+		std::vector<std::size_t> nextSibling;
+
+	public:
+		FlatTree() = default;
+
+		template<typename ExtensionFunction_>
+		static FlatTree Build(T* init, ExtensionFunction_ ExtensionFunction)
+		{
+			FlatTree tree;
+
+			// Index of every node on the current path, and of its last entered child.
+			std::vector<std::pair<std::size_t, std::size_t>> path;
+			DFS::Heap::Traverse(init, ExtensionFunction, [&](T* object, DFS::Action action) {
+				if (action == DFS::Action::Exit)
+				{
+					tree.subtreeEnd[path.back().first] = tree.objects.size();
+					path.pop_back();
+					return;
+				}
+
+				const auto index = tree.objects.size();
+				tree.objects.push_back(object);
+				tree.subtreeEnd.push_back(npos);
+				tree.parent.push_back(path.empty() ? npos : path.back().first);
+				tree.depth.push_back(path.size());
+				tree.firstChild.push_back(npos);
+				tree.nextSibling.push_back(npos);
+
+				if (!path.empty())
+				{
+					auto& [parentIndex, lastChild] = path.back();
+					if (lastChild == npos)
+					{
+						tree.firstChild[parentIndex] = index;
+					}
+					else
+					{
+						tree.nextSibling[lastChild] = index;
+					}
+					lastChild = index;
+				}
+				path.emplace_back(index, npos);
+			});
+
+			return tree;
+		}
+
+		std::size_t Size() const
+		{
+			return objects.size();
+		}
+
+		bool Empty() const
+		{
+			return objects.empty();
+		}
+
+		T* operator[](std::size_t index) const
+		{
+			return objects[index];
+		}
+
+		// Objects in pre-order.
+		const std::vector<T*>& Objects() const
+		{
+			return objects;
+		}
+
+		std::size_t SubtreeEnd(std::size_t index) const
+		{
+			return subtreeEnd[index];
+		}
+
+		std::size_t SubtreeSize(std::size_t index) const
+		{
+			return subtreeEnd[index] - index;
+		}
+
+		// Returns npos for the root.
+		std::size_t Parent(std::size_t index) const
+		{
+			return parent[index];
+		}
+
+		// The root has depth 0.
+		std::size_t Depth(std::size_t index) const
+		{
+			return depth[index];
+		}
+
+		// Returns npos if the node has no children.
+		std::size_t FirstChild(std::size_t index) const
+		{
+			return firstChild[index];
+		}
+
+		// Returns npos if the node is the last child.
+		std::size_t NextSibling(std::size_t index) const
+		{
+			return nextSibling[index];
+		}
+
+		// Returns true if index is in the subtree of ancestor, including ancestor itself.
+		bool IsAncestor(std::size_t ancestor, std::size_t index) const
+		{
+			return ancestor <= index && index < subtreeEnd[ancestor];
+		}
+
+		// Executes the entry and exit functions with the index of every node, in DFS order.
+		template<typename EntryAction_, typename ExitAction_>
+		void Execute(EntryAction_ EntryAction, ExitAction_ ExitAction) const
+		{
+			for (std::size_t i = 0; i < objects.size(); i++)
+			{
+				// Exit every node between the previous node and the parent of this node.
+				for (auto j = i - 1; i != 0 && j != parent[i]; j = parent[j])
+				{
+					std::invoke(ExitAction, j);
+				}
+				std::invoke(EntryAction, i);
+			}
+
+			for (auto j = objects.size() - 1; !objects.empty() && j != npos; j = parent[j])
+			{
+				std::invoke(ExitAction, j);
+			}
+		}
+
+		// Actions equal to the output of DFS::Search.
+		std::vector<std::pair<T*, DFS::Action>> Search() const
+		{
+			std::vector<std::pair<T*, DFS::Action>> actions;
+			actions.reserve(2 * objects.size());
+			Execute(
+				[&](std::size_t index) {
+					actions.emplace_back(objects[index], DFS::Action::Entry);
+				},
+				[&](std::size_t index) {
+					actions.emplace_back(objects[index], DFS::Action::Exit);
+				});
+
+			return actions;
+		}
+
+		// Indices of the nodes in BFS order.
+		std::vector<std::size_t> BreadthFirstOrder() const
+		{
+			std::vector<std::size_t> order;
+			if (objects.empty())
+			{
+				return order;
+			}
+
+			order.reserve(objects.size());
+			order.push_back(0);
+			for (std::size_t i = 0; i < order.size(); i++)
+			{
+				for (auto child = firstChild[order[i]]; child != npos; child = nextSibling[child])
+				{
+					order.push_back(child);
+				}
+			}
+
+			return order;
+		}
+	};
+}
+
+#endif // DEAMER_ALGORITHM_TREE_FLATTREE_H
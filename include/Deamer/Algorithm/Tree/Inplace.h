@@ -4,7 +4,9 @@
 #include <vector>
 #include <set>
 #include <map>
+#include <optional>
 #include <stack>
+#include <unordered_map>
 #include <iostream>
 #include <functional>
 #include <type_traits>
@@ -26,9 +28,73 @@ namespace deamer::algorithm::tree
 	 *	```
 	 *	\details These meta functions, construct a sequence of calls. These calls
 	 *	can be executed in order, with a given operator or function in between return values.
+	 *
+	 *	Fold evaluates the pattern iteratively while walking up the ancestors, without storing
+	 *	the sequence of calls. The direction decides the side the value of an ancestor is
+	 *	combined on:
+	 *	- Upward: Operation(value, Function(ancestor))
+	 *	- Downward: Operation(Function(ancestor), value)
+	 *	For an associative operation Upward equals the recursive pattern, which is evaluated as
+	 *	written by Stack::Fold. Downward folds from the root down to the node, thus it only
+	 *	equals the pattern if the operation is also commutative.
 	 */
 	struct Inplace
 	{
+		enum class Direction
+		{
+			Upward,
+			Downward,
+		};
+
+		template<typename T, typename Function_>
+		using Result_t = std::decay_t<std::invoke_result_t<Function_&, T*>>;
+
+		// Folds the values of t and its ancestors, returns nothing if t is nullptr.
+		template<Direction direction_ = Direction::Upward, typename T, typename ParentFunction_,
+				 typename Function_, typename Operation_>
+		static std::optional<Result_t<T, Function_>> Fold(T* t, ParentFunction_ GetParentFunction,
+														  Function_ Function, Operation_ Operation)
+		{
+			if (t == nullptr)
+			{
+				return std::nullopt;
+			}
+
+			Result_t<T, Function_> value = std::invoke(Function, t);
+			for (T* ancestor = std::invoke(GetParentFunction, t); ancestor != nullptr;
+				 ancestor = std::invoke(GetParentFunction, ancestor))
+			{
+				value = Inplace::Combine<direction_>(Operation, std::move(value),
+													 std::invoke(Function, ancestor));
+			}
+
+			return value;
+		}
+
+		// Folds the values of t and its ancestors, the ancestors are visited as long as the
+		// condition holds for the last visited node.
+		template<Direction direction_ = Direction::Upward, typename T, typename ParentFunction_,
+				 typename Function_, typename Operation_, typename Conditional_>
+		static std::optional<Result_t<T, Function_>>
+		Fold(T* t, ParentFunction_ GetParentFunction, Function_ Function, Operation_ Operation,
+			 Conditional_ ConditionalRecurseFunction)
+		{
+			if (t == nullptr)
+			{
+				return std::nullopt;
+			}
+
+			Result_t<T, Function_> value = std::invoke(Function, t);
+			while (std::invoke(ConditionalRecurseFunction, t))
+			{
+				t = std::invoke(GetParentFunction, t);
+				value = Inplace::Combine<direction_>(Operation, std::move(value),
+													 std::invoke(Function, t));
+			}
+
+			return value;
+		}
+
 		struct Heap
 		{
 			template<typename T, typename ParentFunction_>
@@ -68,30 +134,161 @@ namespace deamer::algorithm::tree
 			}
 		};
 		
+		// Evaluates the recursive pattern as written, recursing once per ancestor.
+		// Can cause stack overflows on deep trees.
 		struct Stack
 		{
+			template<typename T, typename ParentFunction_, typename Function_,
+					 typename Operation_>
+			static std::optional<Result_t<T, Function_>>
+			Fold(T* t, ParentFunction_ GetParentFunction, Function_ Function, Operation_ Operation)
+			{
+				if (t == nullptr)
+				{
+					return std::nullopt;
+				}
+
+				auto hasParent = [&GetParentFunction](T* t_) {
+					return std::invoke(GetParentFunction, t_) != nullptr;
+				};
+				return Recurse(t, GetParentFunction, Function, Operation, hasParent);
+			}
+
+			template<typename T, typename ParentFunction_, typename Function_,
+					 typename Operation_, typename Conditional_>
+			static std::optional<Result_t<T, Function_>>
+			Fold(T* t, ParentFunction_ GetParentFunction, Function_ Function, Operation_ Operation,
+				 Conditional_ ConditionalRecurseFunction)
+			{
+				if (t == nullptr)
+				{
+					return std::nullopt;
+				}
+
+				return Recurse(t, GetParentFunction, Function, Operation,
+							   ConditionalRecurseFunction);
+			}
+
+		private:
+			template<typename T, typename ParentFunction_, typename Function_,
+					 typename Operation_, typename Conditional_>
+			static Result_t<T, Function_> Recurse(T* t, ParentFunction_& GetParentFunction,
+												  Function_& Function, Operation_& Operation,
+												  Conditional_& ConditionalRecurseFunction)
+			{
+				if (std::invoke(ConditionalRecurseFunction, t))
+				{
+					return std::invoke(Operation, std::invoke(Function, t),
+									   Recurse(std::invoke(GetParentFunction, t), GetParentFunction,
+											   Function, Operation, ConditionalRecurseFunction));
+				}
+				else
+				{
+					return std::invoke(Function, t);
+				}
+			}
+		};
+
+		// Evaluates the recursive pattern for many nodes at once. The value of every node is
+		// computed once and memoized, thus nodes sharing ancestors do not walk them again and the
+		// total work is proportional to the number of distinct nodes on the chains.
+		struct Batch
+		{
+			// Returns the value of every start node, in order. Start nodes may not be nullptr.
+			template<typename Starts_, typename ParentFunction_, typename Function_,
+					 typename Operation_>
+			static auto Fold(const Starts_& starts, ParentFunction_ GetParentFunction,
+							 Function_ Function, Operation_ Operation)
+			{
+				auto hasParent = [&GetParentFunction](auto t) {
+					return std::invoke(GetParentFunction, t) != nullptr;
+				};
+				return Batch::Fold(starts, GetParentFunction, Function, Operation, hasParent);
+			}
+
+			template<typename Starts_, typename ParentFunction_, typename Function_,
+					 typename Operation_, typename Conditional_>
+			static auto Fold(const Starts_& starts, ParentFunction_ GetParentFunction,
+							 Function_ Function, Operation_ Operation,
+							 Conditional_ ConditionalRecurseFunction)
+			{
+				using t_T = std::remove_pointer_t<std::decay_t<decltype(*std::begin(starts))>>;
+				using result_T = Result_t<t_T, Function_>;
+
+				std::unordered_map<const t_T*, result_T> values;
+				std::vector<t_T*> path;
+				std::vector<result_T> results;
+				for (t_T* t : starts)
+				{
+					// Walks up until a memoized node, or the node ending the chain.
+					const result_T* known = nullptr;
+					while (true)
+					{
+						const auto iterator = values.find(t);
+						if (iterator != values.end())
+						{
+							known = &iterator->second;
+							break;
+						}
+
+						path.push_back(t);
+						if (!std::invoke(ConditionalRecurseFunction, t))
+						{
+							break;
+						}
+						t = std::invoke(GetParentFunction, t);
+					}
+
+					// Memoizes the values of the walked nodes, from the top down.
+					while (!path.empty())
+					{
+						t_T* node = path.back();
+						path.pop_back();
+						result_T value = std::invoke(Function, node);
+						if (known != nullptr)
+						{
+							value = std::invoke(Operation, std::move(value), *known);
+						}
+						known = &values.emplace(node, std::move(value)).first->second;
+					}
+
+					results.push_back(*known);
+				}
+
+				return results;
+			}
 		};
 
 		struct Execute
 		{
 			struct Heap
 			{
+				// Calls the action with t and its ancestors, in the order of RequiredCalls.
 				template<typename T, typename ParentFunction_, typename Action>
 				static void Construction(T* t, ParentFunction_ GetParentFunction, Action action)
 				{
-					if (t == nullptr)
+					while (t != nullptr)
 					{
-						return {};
-					}
-					
-					auto requiredCalls = Inplace::Heap::RequiredCalls(t, GetParentFunction);
-					for (auto call : requiredCalls)
-					{
-						action(call);
+						action(t);
+						t = std::invoke(GetParentFunction, t);
 					}
 				}
 			};
 		};
+
+	private:
+		template<Direction direction_, typename Operation_, typename Value_, typename Ancestor_>
+		static Value_ Combine(Operation_& Operation, Value_&& value, Ancestor_&& ancestor)
+		{
+			if constexpr (direction_ == Direction::Upward)
+			{
+				return std::invoke(Operation, std::move(value), std::forward<Ancestor_>(ancestor));
+			}
+			else
+			{
+				return std::invoke(Operation, std::forward<Ancestor_>(ancestor), std::move(value));
+			}
+		}
 	};
 }
 
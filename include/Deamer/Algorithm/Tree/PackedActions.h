@@ -0,0 +1,157 @@
+#ifndef DEAMER_ALGORITHM_TREE_PACKEDACTIONS_H
+#define DEAMER_ALGORITHM_TREE_PACKEDACTIONS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace deamer::algorithm::tree
+{
+	/*!	\class PackedActions
+	 *
+	 *	\brief Sequence of (object, action) pairs, storing every pair in a single pointer.
+	 *
+	 *	\details The action is stored in the lowest bit of the pointer, which is always zero for
+	 *	objects aligned to 2 bytes or more. Compared to std::pair<T*, Action>, this halves the
+	 *	memory used by the actions of a search.
+	 *
+	 *	Elements are returned by value, thus the iterator is an input iterator.
+	 *	Action_ is DFS::Action or BFS::Action.
+	 */
+	template<typename T, typename Action_>
+	class PackedActions
+	{
+	public:
+		using value_type = std::pair<T*, Action_>;
+
+		class iterator
+		{
+		public:
+			using iterator_category = std::input_iterator_tag;
+			using value_type = std::pair<T*, Action_>;
+			using difference_type = std::ptrdiff_t;
+			using pointer = void;
+			using reference = value_type;
+
+		private:
+			const std::uintptr_t* current = nullptr;
+
+		public:
+			iterator() = default;
+
+			explicit iterator(const std::uintptr_t* current_) : current(current_)
+			{
+			}
+
+			reference operator*() const
+			{
+				return PackedActions::Unpack(*current);
+			}
+
+			iterator& operator++()
+			{
+				++current;
+				return *this;
+			}
+
+			iterator operator++(int)
+			{
+				auto tmp = *this;
+				++current;
+				return tmp;
+			}
+
+			bool operator==(const iterator& rhs) const
+			{
+				return current == rhs.current;
+			}
+
+			bool operator!=(const iterator& rhs) const
+			{
+				return current != rhs.current;
+			}
+		};
+
+	private:
+		static constexpr std::uintptr_t exitBit = 1;
+
+		std::vector<std::uintptr_t> actions;
+
+	public:
+		PackedActions() = default;
+
+		void push_back(const value_type& value)
+		{
+			emplace_back(value.first, value.second);
+		}
+
+		void emplace_back(T* object, Action_ action)
+		{
+			static_assert(alignof(T) >= 2, "The lowest bit of the pointer is used for the action");
+
+			actions.push_back(reinterpret_cast<std::uintptr_t>(object) |
+							  (action == Action_::Exit ? exitBit : 0));
+		}
+
+		value_type operator[](std::size_t index) const
+		{
+			return Unpack(actions[index]);
+		}
+
+		T* Object(std::size_t index) const
+		{
+			return reinterpret_cast<T*>(actions[index] & ~exitBit);
+		}
+
+		bool IsExit(std::size_t index) const
+		{
+			return (actions[index] & exitBit) != 0;
+		}
+
+		std::size_t size() const
+		{
+			return actions.size();
+		}
+
+		bool empty() const
+		{
+			return actions.empty();
+		}
+
+		void reserve(std::size_t capacity)
+		{
+			actions.reserve(capacity);
+		}
+
+		std::size_t capacity() const
+		{
+			return actions.capacity();
+		}
+
+		void clear()
+		{
+			actions.clear();
+		}
+
+		iterator begin() const
+		{
+			return iterator(actions.data());
+		}
+
+		iterator end() const
+		{
+			return iterator(actions.data() + actions.size());
+		}
+
+	private:
+		static value_type Unpack(std::uintptr_t action)
+		{
+			return {reinterpret_cast<T*>(action & ~exitBit),
+					(action & exitBit) != 0 ? Action_::Exit : Action_::Entry};
+		}
+	};
+}
+
+#endif // DEAMER_ALGORITHM_TREE_PACKEDACTIONS_H
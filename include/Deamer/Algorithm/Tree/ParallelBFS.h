@@ -0,0 +1,101 @@
+#ifndef DEAMER_ALGORITHM_TREE_PARALLELBFS_H
+#define DEAMER_ALGORITHM_TREE_PARALLELBFS_H
+
+#include "Deamer/Algorithm/Thread/Pool.h"
+#include "Deamer/Algorithm/Tree/BFS.h"
+#include "Deamer/Algorithm/Tree/Extension.h"
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace deamer::algorithm::tree
+{
+	// Expands every level of the frontier on the given thread pool. The pool is reused between
+	// searches, thus its threads are only started once.
+	// Every chunk of a level is expanded into its own buffer, the buffers are concatenated in
+	// the order of the level, thus the output is equal to BFS::Search.
+	// The extension function is called concurrently, it is required to be thread-safe.
+	struct ParallelBFS
+	{
+		// Levels smaller than this are expanded on the calling thread.
+		static constexpr std::size_t chunkSize = 64;
+
+		template<typename T, typename ExtensionFunction_>
+		static std::vector<std::pair<T*, BFS::Action>>
+		Search(thread::Pool& pool, T* init, ExtensionFunction_ ExtensionFunction)
+		{
+			if (init == nullptr)
+			{
+				return {};
+			}
+
+			std::size_t index = 0;
+			std::vector<std::pair<T*, BFS::Action>> actions;
+			std::vector<std::vector<T*>> buffers;
+			actions.emplace_back(init, BFS::Action::Entry);
+
+			while (index != actions.size())
+			{
+				const auto stopIndex = actions.size();
+				const auto levelSize = stopIndex - index;
+				const auto chunks =
+					std::min(4 * pool.Size(), (levelSize + chunkSize - 1) / chunkSize);
+
+				if (chunks <= 1)
+				{
+					for (; index < stopIndex; index++)
+					{
+						Extension::ForEach(ExtensionFunction, actions[index].first,
+										   [&actions](T* subnode) {
+											   actions.emplace_back(subnode, BFS::Action::Entry);
+										   });
+					}
+					continue;
+				}
+
+				buffers.resize(std::max(buffers.size(), chunks));
+				{
+					thread::TaskGroup group(pool);
+					for (std::size_t chunk = 0; chunk < chunks; chunk++)
+					{
+						const auto begin = index + levelSize * chunk / chunks;
+						const auto end = index + levelSize * (chunk + 1) / chunks;
+						group.Run([&actions, &buffers, &ExtensionFunction, chunk, begin,
+								   end]() {
+							auto& buffer = buffers[chunk];
+							buffer.clear();
+							for (auto i = begin; i < end; i++)
+							{
+								Extension::ForEach(
+									ExtensionFunction, actions[i].first,
+									[&buffer](T* subnode) { buffer.push_back(subnode); });
+							}
+						});
+					}
+					group.Wait();
+				}
+
+				for (std::size_t chunk = 0; chunk < chunks; chunk++)
+				{
+					for (auto subnode : buffers[chunk])
+					{
+						actions.emplace_back(subnode, BFS::Action::Entry);
+					}
+				}
+				index = stopIndex;
+			}
+
+			const auto currentEnding = actions.size();
+			for (auto i = currentEnding; i > 0; --i)
+			{
+				auto object = actions[i - 1].first;
+				actions.emplace_back(object, BFS::Action::Exit);
+			}
+
+			return actions;
+		}
+	};
+}
+
+#endif // DEAMER_ALGORITHM_TREE_PARALLELBFS_H
@@ -0,0 +1,168 @@
+#ifndef DEAMER_ALGORITHM_TREE_PARALLELDFS_H
+#define DEAMER_ALGORITHM_TREE_PARALLELDFS_H
+
+#include "Deamer/Algorithm/Thread/Pool.h"
+#include "Deamer/Algorithm/Tree/Control.h"
+#include "Deamer/Algorithm/Tree/Extension.h"
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace deamer::algorithm::tree
+{
+	// Executes entry and exit functions on the given work-stealing thread pool. The pool is
+	// reused between traversals, thus its threads are only started once.
+	// The tree is split at every subnode for which the split function returns true, the subtree
+	// of such a node is executed as a separate task.
+	// Within a task the order is equal to DFS::Execute: the entry of a node is executed before its
+	// subnodes, the exit after all its subnodes are done, including the split subnodes.
+	// The optional merge function is called as merge(object, splitSubnode) after the task of
+	// the split subnode is done and before the exit of the object, in the order of the
+	// subnodes. Functions of different tasks are called concurrently, they are required to be
+	// thread-safe.
+	struct ParallelDFS
+	{
+		template<typename T, typename ExtensionFunction_, typename SplitFunction_,
+				 typename EntryAction_, typename ExitAction_>
+		static void Execute(thread::Pool& pool, T* init, ExtensionFunction_ ExtensionFunction,
+							SplitFunction_ SplitFunction, EntryAction_ EntryAction,
+							ExitAction_ ExitAction)
+		{
+			ParallelDFS::Execute(pool, init, ExtensionFunction, SplitFunction, EntryAction,
+								 ExitAction, [](auto, auto) {});
+		}
+
+		template<typename T, typename ExtensionFunction_, typename SplitFunction_,
+				 typename EntryAction_, typename ExitAction_, typename MergeAction_>
+		static void Execute(thread::Pool& pool, T* init, ExtensionFunction_ ExtensionFunction,
+							SplitFunction_ SplitFunction, EntryAction_ EntryAction,
+							ExitAction_ ExitAction, MergeAction_ MergeAction)
+		{
+			using store_T = Extension::Store_t<T, ExtensionFunction_>;
+
+			if (init == nullptr)
+			{
+				return;
+			}
+
+			Shared<ExtensionFunction_, SplitFunction_, EntryAction_, ExitAction_,
+				   MergeAction_>
+				shared{pool, ExtensionFunction, SplitFunction, EntryAction, ExitAction,
+					   MergeAction, false};
+			ParallelDFS::Task<store_T>(shared, init);
+		}
+
+	private:
+		template<typename ExtensionFunction_, typename SplitFunction_, typename EntryAction_,
+				 typename ExitAction_, typename MergeAction_>
+		struct Shared
+		{
+			thread::Pool& pool;
+			ExtensionFunction_ ExtensionFunction;
+			SplitFunction_ SplitFunction;
+			EntryAction_ EntryAction;
+			ExitAction_ ExitAction;
+			MergeAction_ MergeAction;
+			std::atomic<bool> stopped;
+		};
+
+		// Executes the subtree of init, spawning a task for every split subnode.
+		template<typename store_T, typename Shared_>
+		static void Task(Shared_& shared, store_T init)
+		{
+			// The subnodes and split subnodes of a frame are stored at the end of the
+			// buffers, as long as the frame is at the top of the stack.
+			struct Frame
+			{
+				store_T object;
+				std::size_t begin;
+				std::size_t next;
+				std::size_t splitBegin;
+				std::unique_ptr<thread::TaskGroup> group;
+			};
+
+			std::vector<store_T> subnodes;
+			std::vector<store_T> splits;
+			std::vector<Frame> frames;
+			store_T t = init;
+
+			while (true)
+			{
+				if (shared.stopped)
+				{
+					return;
+				}
+
+				const auto control = Visitor::Call(shared.EntryAction, t);
+				if (control == Control::Stop)
+				{
+					shared.stopped = true;
+					return;
+				}
+
+				Frame frame{t, subnodes.size(), subnodes.size(), splits.size(), nullptr};
+				if (control != Control::SkipChildren)
+				{
+					Extension::ForEach(shared.ExtensionFunction, t, [&](store_T subnode) {
+						if (!std::invoke(shared.SplitFunction, subnode))
+						{
+							subnodes.push_back(subnode);
+							return;
+						}
+
+						if (frame.group == nullptr)
+						{
+							frame.group = std::make_unique<thread::TaskGroup>(shared.pool);
+						}
+						splits.push_back(subnode);
+						frame.group->Run([&shared, subnode]() {
+							ParallelDFS::Task<store_T>(shared, subnode);
+						});
+					});
+				}
+				frames.push_back(std::move(frame));
+
+				while (true)
+				{
+					auto& top = frames.back();
+					if (top.next != subnodes.size())
+					{
+						t = subnodes[top.next++];
+						break;
+					}
+
+					if (top.group != nullptr)
+					{
+						top.group->Wait();
+					}
+					if (shared.stopped)
+					{
+						return;
+					}
+
+					for (auto i = top.splitBegin; i < splits.size(); i++)
+					{
+						std::invoke(shared.MergeAction, top.object, splits[i]);
+					}
+					if (Visitor::Call(shared.ExitAction, top.object) == Control::Stop)
+					{
+						shared.stopped = true;
+						return;
+					}
+
+					subnodes.resize(top.begin);
+					splits.resize(top.splitBegin);
+					frames.pop_back();
+					if (frames.empty())
+					{
+						return;
+					}
+				}
+			}
+		}
+	};
+}
+
+#endif // DEAMER_ALGORITHM_TREE_PARALLELDFS_H
@@ -0,0 +1,83 @@
+#ifndef DEAMER_ALGORITHM_TREE_PREFETCH_H
+#define DEAMER_ALGORITHM_TREE_PREFETCH_H
+
+#include "Deamer/Algorithm/Memory/Cache.h"
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+namespace deamer::algorithm::tree
+{
+	/*!	\class Prefetch
+	 *
+	 *	\brief Opt-in policy for searches to prefetch the objects they visit next.
+	 *
+	 *	\details Given a policy, a search prefetches the object the given distance ahead in its
+	 *	stack or queue, before expanding the current object. Thus its memory is loaded while the
+	 *	objects in between are processed.
+	 *
+	 *	The optional address function returns further memory of an object to prefetch, e.g. the
+	 *	storage of its subnodes. As it reads the object, it is called for the object half the
+	 *	distance ahead, which has already been prefetched.
+	 *	```
+	 *	Prefetch(8, [](const Node* node) { return node->subNodes.data(); })
+	 *	```
+	 *
+	 *	Prefetching pays off for large trees of which the nodes are scattered over memory. For
+	 *	trees fitting in the cache, it only adds instructions.
+	 */
+	template<typename AddressFunction_ = std::nullptr_t>
+	class Prefetch
+	{
+	private:
+		std::size_t distance;
+		AddressFunction_ addressFunction;
+
+	public:
+		explicit Prefetch(std::size_t distance_ = 4) : distance(distance_), addressFunction()
+		{
+		}
+
+		Prefetch(std::size_t distance_, AddressFunction_ addressFunction_)
+			: distance(distance_),
+			  addressFunction(addressFunction_)
+		{
+		}
+
+		std::size_t Distance() const
+		{
+			return distance;
+		}
+
+		// Prefetches the objects in [first, min(first + distance, last)).
+		template<typename Get_>
+		void Window(std::size_t first, std::size_t last, Get_&& get) const
+		{
+			for (auto i = first; i < last && i < first + distance; i++)
+			{
+				memory::Cache::Prefetch(get(i));
+			}
+		}
+
+		// Prefetches ahead of index, in the objects [0, last) visited in order.
+		template<typename Get_>
+		void Ahead(std::size_t index, std::size_t last, Get_&& get) const
+		{
+			if (index + distance < last)
+			{
+				memory::Cache::Prefetch(get(index + distance));
+			}
+
+			if constexpr (!std::is_null_pointer_v<AddressFunction_>)
+			{
+				const auto storage = index + distance / 2;
+				if (storage < last)
+				{
+					memory::Cache::Prefetch(std::invoke(addressFunction, get(storage)));
+				}
+			}
+		}
+	};
+}
+
+#endif // DEAMER_ALGORITHM_TREE_PREFETCH_H
@@ -0,0 +1,95 @@
+#ifndef DEAMER_ALGORITHM_TREE_SIZEHINT_H
+#define DEAMER_ALGORITHM_TREE_SIZEHINT_H
+
+#include "Deamer/Algorithm/Tree/Extension.h"
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace deamer::algorithm::tree
+{
+	/*!	\class SizeHint
+	 *
+	 *	\brief Number of nodes expected in a search, used to reserve its output at once.
+	 *
+	 *	\details A search outputs twice the number of nodes, thus 2N actions are reserved.
+	 *	The hint may be an estimate, if it is too small the output grows as usual.
+	 *
+	 *	Count requests an additional traversal counting the nodes before the search. This trades
+	 *	time for peak memory: the output is allocated exactly once, instead of regrowing and
+	 *	copying while it is filled.
+	 */
+	class SizeHint
+	{
+	private:
+		std::size_t nodes = 0;
+		bool count = false;
+
+		SizeHint(std::size_t nodes_, bool count_) : nodes(nodes_), count(count_)
+		{
+		}
+
+	public:
+		static SizeHint Nodes(std::size_t nodes)
+		{
+			return SizeHint(nodes, false);
+		}
+
+		// The function returns the number of nodes in the subtree of the given node.
+		template<typename T, typename SubtreeSizeFunction_>
+		static SizeHint Subtree(T* init, SubtreeSizeFunction_ SubtreeSizeFunction)
+		{
+			if (init == nullptr)
+			{
+				return SizeHint(0, false);
+			}
+
+			return SizeHint(static_cast<std::size_t>(std::invoke(SubtreeSizeFunction, init)),
+							false);
+		}
+
+		static SizeHint Count()
+		{
+			return SizeHint(0, true);
+		}
+
+		// Number of nodes to reserve for, counting them if requested.
+		template<typename T, typename ExtensionFunction_>
+		std::size_t Resolve(T* init, ExtensionFunction_ ExtensionFunction) const
+		{
+			if (!count)
+			{
+				return nodes;
+			}
+
+			if (init == nullptr)
+			{
+				return 0;
+			}
+
+			// The order is irrelevant for counting, thus a plain stack of pending nodes suffices.
+			std::vector<Extension::Store_t<T, ExtensionFunction_>> pending{init};
+			std::size_t counted = 0;
+			while (!pending.empty())
+			{
+				auto t = pending.back();
+				pending.pop_back();
+				counted++;
+
+				Extension::ForEach(ExtensionFunction, t,
+								   [&pending](auto subnode) { pending.push_back(subnode); });
+			}
+
+			return counted;
+		}
+
+		// Reserves the actions of a search from init, in addition to the present actions.
+		template<typename Actions_, typename T, typename ExtensionFunction_>
+		void Reserve(Actions_& actions, T* init, ExtensionFunction_ ExtensionFunction) const
+		{
+			actions.reserve(actions.size() + 2 * Resolve(init, ExtensionFunction));
+		}
+	};
+}
+
+#endif // DEAMER_ALGORITHM_TREE_SIZEHINT_H
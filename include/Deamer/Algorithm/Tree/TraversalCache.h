@@ -0,0 +1,149 @@
+#ifndef DEAMER_ALGORITHM_TREE_TRAVERSALCACHE_H
+#define DEAMER_ALGORITHM_TREE_TRAVERSALCACHE_H
+
+#include "Deamer/Algorithm/Tree/BFS.h"
+#include "Deamer/Algorithm/Tree/DFS.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+namespace deamer::algorithm::tree
+{
+	/*!	\class TraversalCache
+	 *
+	 *	\brief Caches the DFS and BFS orders of trees, keyed by their root.
+	 *
+	 *	\details An order is computed when it is first requested, later requests return the
+	 *	stored order. The cache does not observe the trees, thus after a tree changes either:
+	 *	- Invalidate its root, or Clear the cache
+	 *	- or construct the cache with a version function. Its result is stored with the orders of
+	 *	a root, and compared on every request. If it differs the orders are recomputed.
+	 *
+	 *	The extension function is only called when an order is computed, thus a cache should be
+	 *	used with a single extension function.
+	 *	Returned orders stay valid until their root is invalidated, recomputed or the cache is
+	 *	cleared. The cache is not thread-safe.
+	 *
+	 *	T is the type of the objects, e.g. const Node if the extension function gives const
+	 *	subnodes.
+	 */
+	template<typename T, typename Version_ = std::uint64_t>
+	class TraversalCache
+	{
+	private:
+		struct Orders
+		{
+			Version_ version{};
+			std::optional<DFS::Actions_t<T*>> depthFirst;
+			std::optional<BFS::Actions_t<T*>> breadthFirst;
+		};
+
+		std::function<Version_(const T*)> versionFunction;
+		std::unordered_map<const T*, Orders> cache;
+
+	public:
+		TraversalCache() = default;
+
+		explicit TraversalCache(std::function<Version_(const T*)> versionFunction_)
+			: versionFunction(std::move(versionFunction_))
+		{
+		}
+
+		template<typename ExtensionFunction_>
+		const DFS::Actions_t<T*>& DepthFirst(T* root, ExtensionFunction_ ExtensionFunction)
+		{
+			auto& orders = Lookup(root);
+			if (!orders.depthFirst.has_value())
+			{
+				orders.depthFirst.emplace();
+				DFS::Heap::Search(*orders.depthFirst, root, ExtensionFunction);
+			}
+
+			return *orders.depthFirst;
+		}
+
+		template<typename ExtensionFunction_>
+		const BFS::Actions_t<T*>& BreadthFirst(T* root, ExtensionFunction_ ExtensionFunction)
+		{
+			auto& orders = Lookup(root);
+			if (!orders.breadthFirst.has_value())
+			{
+				orders.breadthFirst.emplace();
+				BFS::Search(*orders.breadthFirst, root, ExtensionFunction);
+			}
+
+			return *orders.breadthFirst;
+		}
+
+		// Replays the cached DFS order, see DFS::Replay.
+		template<typename ExtensionFunction_, typename EntryAction_, typename ExitAction_>
+		void Execute(T* root, ExtensionFunction_ ExtensionFunction, EntryAction_ EntryAction,
+					 ExitAction_ ExitAction)
+		{
+			DFS::Replay(DepthFirst(root, ExtensionFunction), EntryAction, ExitAction);
+		}
+
+		// Updates the cached DFS order of the root after the given subtrees have been edited, see
+		// DFS::Incremental. The BFS order is recomputed on its next request.
+		template<typename Roots_, typename ExtensionFunction_>
+		void Update(T* root, const Roots_& modifiedRoots, ExtensionFunction_ ExtensionFunction)
+		{
+			auto iterator = cache.find(root);
+			if (iterator == cache.end())
+			{
+				return;
+			}
+
+			auto& orders = iterator->second;
+			if (versionFunction)
+			{
+				orders.version = versionFunction(root);
+			}
+			orders.breadthFirst.reset();
+			if (orders.depthFirst.has_value())
+			{
+				DFS::Incremental::Update(*orders.depthFirst, modifiedRoots, ExtensionFunction);
+			}
+		}
+
+		bool Contains(const T* root) const
+		{
+			return cache.find(root) != cache.end();
+		}
+
+		void Invalidate(const T* root)
+		{
+			cache.erase(root);
+		}
+
+		void Clear()
+		{
+			cache.clear();
+		}
+
+		std::size_t Size() const
+		{
+			return cache.size();
+		}
+
+	private:
+		Orders& Lookup(T* root)
+		{
+			const auto version = versionFunction ? versionFunction(root) : Version_{};
+			auto [iterator, inserted] = cache.try_emplace(root);
+			auto& orders = iterator->second;
+			if (inserted || orders.version != version)
+			{
+				orders = Orders();
+				orders.version = version;
+			}
+
+			return orders;
+		}
+	};
+}
+
+#endif // DEAMER_ALGORITHM_TREE_TRAVERSALCACHE_H
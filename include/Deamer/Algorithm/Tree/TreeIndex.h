@@ -0,0 +1,195 @@
+#ifndef DEAMER_ALGORITHM_TREE_TREEINDEX_H
+#define DEAMER_ALGORITHM_TREE_TREEINDEX_H
+
+#include "Deamer/Algorithm/Tree/FlatTree.h"
+#include <algorithm>
+#include <cstddef>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace deamer::algorithm::tree
+{
+	/*!	\class TreeIndex
+	 *
+	 *	\brief Index over a FlatTree, answering ancestor queries without walking the tree.
+	 *
+	 *	\details Nodes are referred to by their pre-order index in the FlatTree, or by their
+	 *	object using the queries suffixed with Of. The following queries are supported:
+	 *	- IsAncestor and Depth in O(1), using the subtree ranges of the FlatTree
+	 *	- LowestCommonAncestor in O(1), using a sparse table over the depths in pre-order
+	 *	- Ancestor, the k-th ancestor, in O(log n) using the nodes per depth
+	 *
+	 *	The lowest common ancestor of u < v is the parent of the shallowest node in (u, v], as
+	 *	that node is the child of the lowest common ancestor containing v.
+	 *	The sparse table uses O(n log n) memory. The index is not updated if the tree changes.
+	 *	Indices passed to the queries must be in the tree, objects may be unknown.
+	 */
+	template<typename T>
+	class TreeIndex
+	{
+	public:
+		static constexpr std::size_t npos = FlatTree<T>::npos;
+
+	private:
+		FlatTree<T> tree;
+		std::unordered_map<const T*, std::size_t> indices;
+		// minima[k][i] is the shallowest node in [i, i + 2^k).
+		std::vector<std::vector<std::size_t>> minima;
+		// log2[n] is the floor of the binary logarithm of n.
+		std::vector<std::size_t> log2;
+		// Nodes per depth, in pre-order.
+		std::vector<std::vector<std::size_t>> levels;
+
+	public:
+		TreeIndex() = default;
+
+		explicit TreeIndex(FlatTree<T> tree_) : tree(std::move(tree_))
+		{
+			const auto size = tree.Size();
+			indices.reserve(size);
+			log2.assign(size + 1, 0);
+			for (std::size_t i = 0; i < size; i++)
+			{
+				indices.emplace(tree[i], i);
+				if (tree.Depth(i) == levels.size())
+				{
+					levels.emplace_back();
+				}
+				levels[tree.Depth(i)].push_back(i);
+			}
+			for (std::size_t n = 2; n <= size; n++)
+			{
+				log2[n] = log2[n / 2] + 1;
+			}
+
+			if (size == 0)
+			{
+				return;
+			}
+
+			minima.resize(log2[size] + 1);
+			minima[0].resize(size);
+			for (std::size_t i = 0; i < size; i++)
+			{
+				minima[0][i] = i;
+			}
+			for (std::size_t k = 1; k < minima.size(); k++)
+			{
+				const std::size_t half = std::size_t(1) << (k - 1);
+				minima[k].resize(size - 2 * half + 1);
+				for (std::size_t i = 0; i < minima[k].size(); i++)
+				{
+					minima[k][i] = Shallowest(minima[k - 1][i], minima[k - 1][i + half]);
+				}
+			}
+		}
+
+		template<typename ExtensionFunction_>
+		static TreeIndex Build(T* init, ExtensionFunction_ ExtensionFunction)
+		{
+			return TreeIndex(FlatTree<T>::Build(init, ExtensionFunction));
+		}
+
+		const FlatTree<T>& Tree() const
+		{
+			return tree;
+		}
+
+		// Returns npos if the object is not in the tree.
+		std::size_t Index(const T* object) const
+		{
+			const auto iterator = indices.find(object);
+			return iterator == indices.end() ? npos : iterator->second;
+		}
+
+		// The root has depth 0.
+		std::size_t Depth(std::size_t index) const
+		{
+			return tree.Depth(index);
+		}
+
+		// Returns true if index is in the subtree of ancestor, including ancestor itself.
+		bool IsAncestor(std::size_t ancestor, std::size_t index) const
+		{
+			return tree.IsAncestor(ancestor, index);
+		}
+
+		std::size_t LowestCommonAncestor(std::size_t lhs, std::size_t rhs) const
+		{
+			if (lhs == rhs)
+			{
+				return lhs;
+			}
+
+			const auto [first, last] = std::minmax(lhs, rhs);
+
+			// Shallowest node in (first, last].
+			const auto k = log2[last - first];
+			const auto shallowest =
+				Shallowest(minima[k][first + 1], minima[k][last + 1 - (std::size_t(1) << k)]);
+			return tree.Parent(shallowest);
+		}
+
+		// Returns the k-th ancestor, the node itself for k = 0. Returns npos if k exceeds the
+		// depth of the node.
+		std::size_t Ancestor(std::size_t index, std::size_t k) const
+		{
+			const auto depth = tree.Depth(index);
+			if (k > depth)
+			{
+				return npos;
+			}
+
+			// The ancestor is the last node at its depth, preceding the node in pre-order.
+			const auto& level = levels[depth - k];
+			return *(std::upper_bound(level.begin(), level.end(), index) - 1);
+		}
+
+		// The object queries are named apart from the index queries, as 0 converts to both an
+		// index and a pointer. Objects not in the tree give npos, false or nullptr.
+		std::size_t DepthOf(const T* object) const
+		{
+			const auto index = Index(object);
+			return index == npos ? npos : Depth(index);
+		}
+
+		bool IsAncestorOf(const T* ancestor, const T* object) const
+		{
+			const auto ancestorIndex = Index(ancestor);
+			const auto index = Index(object);
+			return ancestorIndex != npos && index != npos && IsAncestor(ancestorIndex, index);
+		}
+
+		T* LowestCommonAncestorOf(const T* lhs, const T* rhs) const
+		{
+			const auto lhsIndex = Index(lhs);
+			const auto rhsIndex = Index(rhs);
+			if (lhsIndex == npos || rhsIndex == npos)
+			{
+				return nullptr;
+			}
+			return tree[LowestCommonAncestor(lhsIndex, rhsIndex)];
+		}
+
+		// Returns nullptr if k exceeds the depth of the object.
+		T* AncestorOf(const T* object, std::size_t k) const
+		{
+			const auto index = Index(object);
+			if (index == npos)
+			{
+				return nullptr;
+			}
+			const auto ancestor = Ancestor(index, k);
+			return ancestor == npos ? nullptr : tree[ancestor];
+		}
+
+	private:
+		std::size_t Shallowest(std::size_t lhs, std::size_t rhs) const
+		{
+			return tree.Depth(rhs) < tree.Depth(lhs) ? rhs : lhs;
+		}
+	};
+}
+
+#endif // DEAMER_ALGORITHM_TREE_TREEINDEX_H
@@ -0,0 +1,51 @@
+#include "Deamer/Algorithm/Thread/Pool.h"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+TEST(TestPool, TaskGroup_Wait_ExecutesAllTasks)
+{
+	deamer::algorithm::thread::Pool pool(4);
+	deamer::algorithm::thread::TaskGroup group(pool);
+	std::atomic<std::size_t> count = 0;
+
+	for (std::size_t i = 0; i < 1000; i++)
+	{
+		group.Run([&count]() { count++; });
+	}
+	group.Wait();
+
+	EXPECT_EQ(1000, count);
+}
+
+TEST(TestPool, TaskGroup_NestedGroups_DoNotDeadlock)
+{
+	deamer::algorithm::thread::Pool pool(2);
+	deamer::algorithm::thread::TaskGroup group(pool);
+	std::atomic<std::size_t> count = 0;
+
+	for (std::size_t i = 0; i < 16; i++)
+	{
+		group.Run([&pool, &count]() {
+			deamer::algorithm::thread::TaskGroup nested(pool);
+			for (std::size_t j = 0; j < 16; j++)
+			{
+				nested.Run([&count]() { count++; });
+			}
+			nested.Wait();
+		});
+	}
+	group.Wait();
+
+	EXPECT_EQ(256, count);
+}
+
+TEST(TestPool, TaskGroup_Wait_RethrowsException)
+{
+	deamer::algorithm::thread::Pool pool(2);
+	deamer::algorithm::thread::TaskGroup group(pool);
+
+	group.Run([]() { throw std::runtime_error("task failed"); });
+
+	EXPECT_THROW(group.Wait(), std::runtime_error);
+}
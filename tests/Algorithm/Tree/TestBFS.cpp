@@ -1,6 +1,10 @@
 #include "Deamer/Algorithm/Tree/BFS.h"
+#include "Deamer/Algorithm/Tree/ParallelBFS.h"
+#include <algorithm>
+#include <array>
 #include <gtest/gtest.h>
 #include <memory>
+#include <memory_resource>
 
 struct Data
 {
@@ -50,6 +54,14 @@ struct Node
 		}
 		return subnodes;
 	}
+
+	void VisitSubNodes(deamer::algorithm::tree::Extension::Sink<Node>& sink) const
+	{
+		for (const auto& subnode : subNodes)
+		{
+			sink(subnode.get());
+		}
+	}
 };
 
 class TestBFS : public testing::Test
@@ -245,6 +257,256 @@ TEST_F(TestBFS, Search_TreeWithTripleChild_CorrectlyCallInAndOutFunctions)
 	}
 }
 
+TEST_F(TestBFS, Range_CorrectlyYieldInAndOutActions)
+{
+	std::vector<std::pair<Node*, deamer::algorithm::tree::BFS::Action>> actions;
+	for (const auto& action : deamer::algorithm::tree::BFS::Range(tree.get(), &Node::GetSubNodes))
+	{
+		actions.push_back(action);
+	}
+
+	TEST_ACTIONS_ARE_CORRECT(tree.get(), actions);
+}
+
+TEST_F(TestBFS, Range_FindFirst_StopsExpanding)
+{
+	std::size_t calls = 0;
+	const auto range = deamer::algorithm::tree::BFS::Range(tree.get(), [&](Node* node) {
+		calls++;
+		return node->GetSubNodes();
+	});
+
+	const auto iter = std::find_if(range.begin(), range.end(), [](const auto& action) {
+		return action.first->GetData().a == 102;
+	});
+
+	ASSERT_NE(range.end(), iter);
+	EXPECT_EQ(deamer::algorithm::tree::BFS::Action::Entry, (*iter).second);
+	EXPECT_EQ(1, calls);
+}
+
+TEST_F(TestBFS, Range_EmptyTree_IsEmpty)
+{
+	const auto range = deamer::algorithm::tree::BFS::Range((Node*)nullptr, &Node::GetSubNodes);
+
+	EXPECT_EQ(range.end(), range.begin());
+}
+
+TEST_F(TestBFS, Execute_CorrectlyCallInAndOutFunctions)
+{
+	std::vector<std::pair<Node*, deamer::algorithm::tree::BFS::Action>> actions;
+	deamer::algorithm::tree::BFS::Execute::Search(
+		tree.get(), &Node::GetSubNodes,
+		[&](Node* node) {
+			actions.emplace_back(node, deamer::algorithm::tree::BFS::Action::Entry);
+		},
+		[&](Node* node) {
+			actions.emplace_back(node, deamer::algorithm::tree::BFS::Action::Exit);
+		});
+
+	TEST_ACTIONS_ARE_CORRECT(tree.get(), actions);
+}
+
+TEST_F(TestBFS, Execute_SkipChildren_DoesNotExpandSubtree)
+{
+	using deamer::algorithm::tree::BFS;
+	std::size_t calls = 0;
+	std::vector<int> entries;
+	std::vector<int> exits;
+	BFS::Execute::Search(
+		tree.get(),
+		[&](Node* node) {
+			calls++;
+			return node->GetSubNodes();
+		},
+		[&](Node* node) {
+			entries.push_back(node->GetData().a);
+			return node->GetData().a == 102 ? BFS::Control::SkipChildren : BFS::Control::Continue;
+		},
+		[&](Node* node) { exits.push_back(node->GetData().a); });
+
+	EXPECT_EQ(4, calls);
+	EXPECT_EQ(std::vector<int>({10, 101, 102, 103, 1031}), entries);
+	EXPECT_EQ(std::vector<int>({1031, 103, 102, 101, 10}), exits);
+}
+
+TEST_F(TestBFS, Execute_Stop_EndsTraversal)
+{
+	using deamer::algorithm::tree::BFS;
+	std::vector<int> entries;
+	std::size_t exits = 0;
+	BFS::Execute::Search(
+		tree.get(), &Node::GetSubNodes,
+		[&](Node* node) {
+			entries.push_back(node->GetData().a);
+			return node->GetData().a == 103 ? BFS::Control::Stop : BFS::Control::Continue;
+		},
+		[&](Node*) { exits++; });
+
+	EXPECT_EQ(std::vector<int>({10, 101, 102, 103}), entries);
+	EXPECT_EQ(0, exits);
+}
+
+TEST_F(TestBFS, ParallelSearch_CorrectlyCallInAndOutFunctions)
+{
+	deamer::algorithm::thread::Pool pool(4);
+	const auto actions =
+		deamer::algorithm::tree::ParallelBFS::Search(pool, tree.get(), &Node::GetSubNodes);
+
+	TEST_ACTIONS_ARE_CORRECT(tree.get(), actions);
+}
+
+TEST_F(TestBFS, ParallelSearch_WideTree_MatchesSearch)
+{
+	auto root = std::make_unique<Node>(Data(0));
+	for (int i = 0; i < 500; i++)
+	{
+		auto subnode = std::make_unique<Node>(Data(i), root.get());
+		for (int j = 0; j < i % 7; j++)
+		{
+			subnode->AddSubNode(std::make_unique<Node>(Data(j), subnode.get()));
+		}
+		root->AddSubNode(std::move(subnode));
+	}
+
+	deamer::algorithm::thread::Pool pool(4);
+	const auto actions =
+		deamer::algorithm::tree::ParallelBFS::Search(pool, root.get(), &Node::GetSubNodes);
+
+	EXPECT_EQ(deamer::algorithm::tree::BFS::Search(root.get(), &Node::GetSubNodes), actions);
+}
+
+TEST_F(TestBFS, ParallelSearch_EmptyTree_DoesNothing)
+{
+	deamer::algorithm::thread::Pool pool(4);
+	const auto actions =
+		deamer::algorithm::tree::ParallelBFS::Search(pool, (Node*)nullptr, &Node::GetSubNodes);
+
+	EXPECT_EQ(0, actions.size());
+}
+
+TEST_F(TestBFS, Levels_CorrectlyStoreLevelsAndParents)
+{
+	const auto levels = deamer::algorithm::tree::BFS::Levels(tree.get(), &Node::GetSubNodes);
+
+	ASSERT_EQ(6, levels.Size());
+	ASSERT_EQ(3, levels.LevelCount());
+	EXPECT_EQ(std::vector<Node*>({tree.get()}),
+			  std::vector<Node*>(levels.Level(0).begin(), levels.Level(0).end()));
+	EXPECT_EQ(tree->GetSubNodes(),
+			  std::vector<Node*>(levels.Level(1).begin(), levels.Level(1).end()));
+	EXPECT_EQ(std::vector<Node*>({tree->GetSubNodes()[1]->GetSubNodes()[0],
+								  tree->GetSubNodes()[2]->GetSubNodes()[0]}),
+			  std::vector<Node*>(levels.Level(2).begin(), levels.Level(2).end()));
+
+	EXPECT_EQ(levels.npos, levels.Parent(0));
+	for (std::size_t i = 1; i < levels.Size(); i++)
+	{
+		EXPECT_EQ(levels[i]->GetParent(), levels[levels.Parent(i)]);
+	}
+
+	TEST_ACTIONS_ARE_CORRECT(tree.get(), levels.Actions());
+}
+
+TEST_F(TestBFS, Levels_EmptyTree_IsEmpty)
+{
+	const auto levels = deamer::algorithm::tree::BFS::Levels((Node*)nullptr, &Node::GetSubNodes);
+
+	EXPECT_TRUE(levels.Empty());
+	EXPECT_EQ(0, levels.LevelCount());
+	EXPECT_TRUE(levels.Exits().empty());
+}
+
+TEST_F(TestBFS, Search_SinkExtension_CorrectlyCallInAndOutFunctions)
+{
+	const auto actions =
+		deamer::algorithm::tree::BFS::Search(tree.get(), &Node::VisitSubNodes);
+
+	TEST_ACTIONS_ARE_CORRECT(tree.get(), actions);
+	deamer::algorithm::thread::Pool pool(4);
+	EXPECT_EQ(actions, deamer::algorithm::tree::ParallelBFS::Search(pool, tree.get(),
+																	&Node::VisitSubNodes));
+	EXPECT_EQ(deamer::algorithm::tree::BFS::Levels(tree.get(), &Node::VisitSubNodes).Actions(),
+			  actions);
+}
+
+TEST_F(TestBFS, Search_MemoryResource_AllocatesOnlyFromResource)
+{
+	// The upstream resource throws, thus any allocation outside the buffer fails the test.
+	std::array<std::byte, 4096> buffer;
+	std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(),
+											  std::pmr::null_memory_resource());
+
+	const auto actions = deamer::algorithm::tree::BFS::Search(std::allocator_arg, &arena,
+															  tree.get(), &Node::VisitSubNodes);
+	TEST_ACTIONS_ARE_CORRECT(tree.get(), {actions.begin(), actions.end()});
+
+	std::size_t count = 0;
+	deamer::algorithm::tree::BFS::Execute::Search(
+		std::allocator_arg, &arena, tree.get(), &Node::VisitSubNodes,
+		[&](Node*) { count++; }, [&](Node*) { count++; });
+	EXPECT_EQ(count, actions.size());
+}
+
+TEST_F(TestBFS, Context_RepeatedSearches_DoNotAllocate)
+{
+	// A monotonic resource never reuses memory, thus allocating on every search exhausts it.
+	std::array<std::byte, 4096> buffer;
+	std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(),
+											  std::pmr::null_memory_resource());
+	deamer::algorithm::tree::BFS::Context<Node, std::pmr::memory_resource*> context(&arena);
+
+	for (auto i = 0; i < 1000; i++)
+	{
+		const auto& actions = context.Search(tree.get(), &Node::VisitSubNodes);
+		TEST_ACTIONS_ARE_CORRECT(tree.get(), {actions.begin(), actions.end()});
+
+		std::size_t count = 0;
+		context.Execute(
+			tree.get(), &Node::VisitSubNodes, [&](Node*) { count++; }, [&](Node*) { count++; });
+		EXPECT_EQ(count, actions.size());
+	}
+}
+
+TEST_F(TestBFS, Search_SizeHint_ReservesExactly)
+{
+	const auto actions = deamer::algorithm::tree::BFS::Search(
+		tree.get(), &Node::GetSubNodes, deamer::algorithm::tree::SizeHint::Count());
+
+	TEST_ACTIONS_ARE_CORRECT(tree.get(), actions);
+	EXPECT_EQ(actions.capacity(), actions.size());
+
+	const auto packed = deamer::algorithm::tree::BFS::SearchPacked(
+		tree.get(), &Node::GetSubNodes, deamer::algorithm::tree::SizeHint::Count());
+	EXPECT_TRUE(std::equal(actions.begin(), actions.end(), packed.begin(), packed.end()));
+	EXPECT_EQ(packed.capacity(), packed.size());
+}
+
+TEST_F(TestBFS, Search_Prefetch_EqualsSearch)
+{
+	using deamer::algorithm::tree::BFS;
+	using deamer::algorithm::tree::Prefetch;
+	const auto expected = BFS::Search(tree.get(), &Node::GetSubNodes);
+
+	for (std::size_t distance = 0; distance < 4; distance++)
+	{
+		EXPECT_EQ(expected, BFS::Search(tree.get(), &Node::GetSubNodes, Prefetch(distance)));
+		EXPECT_EQ(expected, BFS::Search(tree.get(), &Node::GetSubNodes,
+										Prefetch(distance, [](const Node* node) {
+											return node->subNodes.data();
+										})));
+	}
+}
+
+TEST_F(TestBFS, SearchPacked_EqualsSearch)
+{
+	const auto actions = deamer::algorithm::tree::BFS::Search(tree.get(), &Node::GetSubNodes);
+	const auto packed =
+		deamer::algorithm::tree::BFS::SearchPacked(tree.get(), &Node::VisitSubNodes);
+
+	EXPECT_TRUE(std::equal(actions.begin(), actions.end(), packed.begin(), packed.end()));
+}
+
 static void TEST_ACTIONS_ARE_CORRECT(
 	Node* tree, const std::vector<std::pair<Node*, deamer::algorithm::tree::BFS::Action>>& actions)
 {
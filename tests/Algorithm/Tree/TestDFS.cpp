@@ -1,6 +1,14 @@
 #include "Deamer/Algorithm/Tree/DFS.h"
+#include "Deamer/Algorithm/Tree/ParallelDFS.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <gtest/gtest.h>
+#include <map>
 #include <memory>
+#include <memory_resource>
+#include <numeric>
+#include <string>
 #include <vector>
 
 struct Data
@@ -51,6 +59,55 @@ struct Node
 		}
 		return subnodes;
 	}
+
+	void VisitSubNodes(deamer::algorithm::tree::Extension::Sink<const Node>& sink) const
+	{
+		for (const auto& subnode : subNodes)
+		{
+			sink(subnode.get());
+		}
+	}
+};
+
+struct BinaryNode
+{
+	int data;
+	BinaryNode* left = nullptr;
+	BinaryNode* right = nullptr;
+
+	BinaryNode(int data_) : data(data_)
+	{
+	}
+
+	std::array<const BinaryNode*, 2> GetSubNodes() const
+	{
+		return {left, right};
+	}
+
+	std::vector<const BinaryNode*> GetSubNodeVector() const
+	{
+		std::vector<const BinaryNode*> subnodes;
+		for (auto subnode : {left, right})
+		{
+			if (subnode != nullptr)
+			{
+				subnodes.push_back(subnode);
+			}
+		}
+		return subnodes;
+	}
+};
+
+template<>
+struct deamer::algorithm::tree::ChildTraits<BinaryNode>
+{
+	static constexpr std::size_t arity = 2;
+
+	template<std::size_t I>
+	static const BinaryNode* Get(const BinaryNode& node)
+	{
+		return I == 0 ? node.left : node.right;
+	}
 };
 
 class TestDFS : public testing::Test
@@ -436,6 +493,510 @@ TEST_F(TestDFS, HeapParentSearch_WithParent_UnusedRoot_TreeTripleChild_Correctly
 	}
 }
 
+TEST_F(TestDFS, StreamingExecute_CorrectlyCallInAndOutFunctions)
+{
+	std::vector<std::pair<const Node*, deamer::algorithm::tree::DFS::Action>> actions;
+	deamer::algorithm::tree::DFS::Execute::Streaming::Search(
+		tree.get(), &Node::GetSubNodes,
+		[&](const Node* node) {
+			actions.emplace_back(node, deamer::algorithm::tree::DFS::Action::Entry);
+		},
+		[&](const Node* node) {
+			actions.emplace_back(node, deamer::algorithm::tree::DFS::Action::Exit);
+		});
+
+	TEST_ACTIONS_ARE_CORRECT(tree.get(), actions);
+}
+
+TEST_F(TestDFS, StreamingExecute_EmptyTree_DoesNothing)
+{
+	std::size_t calls = 0;
+	deamer::algorithm::tree::DFS::Execute::Streaming::Search(
+		(Node*)nullptr, &Node::GetSubNodes, [&](const Node*) { calls++; },
+		[&](const Node*) { calls++; });
+
+	EXPECT_EQ(0, calls);
+}
+
+TEST_F(TestDFS, HeapSearch_WideAndDeepTree_MatchesStackSearch)
+{
+	auto root = std::make_unique<Node>(Data(0));
+	Node* current = root.get();
+	for (int depth = 1; depth < 50; depth++)
+	{
+		for (int width = 0; width < 5; width++)
+		{
+			current->AddSubNode(std::make_unique<Node>(Data(depth * 10 + width), current));
+		}
+		current = current->subNodes[depth % 5].get();
+	}
+
+	const auto heapActions =
+		deamer::algorithm::tree::DFS::Heap::Search(root.get(), &Node::GetSubNodes);
+	const auto stackActions =
+		deamer::algorithm::tree::DFS::Stack::Search(root.get(), &Node::GetSubNodes);
+
+	EXPECT_EQ(2 * (1 + 49 * 5), heapActions.size());
+	EXPECT_EQ(stackActions, heapActions);
+}
+
+TEST_F(TestDFS, HeapParentSearch_ExpandsEveryNodeOnce)
+{
+	std::size_t calls = 0;
+	const auto actions = deamer::algorithm::tree::DFS::Heap::Search(
+		tree.get(), &Node::GetParent, [&](const Node* node) {
+			calls++;
+			return node->GetSubNodes();
+		});
+
+	EXPECT_EQ(6, calls);
+	TEST_ACTIONS_ARE_CORRECT(tree.get(), actions);
+}
+
+TEST_F(TestDFS, Range_CorrectlyYieldInAndOutActions)
+{
+	std::vector<std::pair<const Node*, deamer::algorithm::tree::DFS::Action>> actions;
+	for (const auto& action : deamer::algorithm::tree::DFS::Range(tree.get(), &Node::GetSubNodes))
+	{
+		actions.push_back(action);
+	}
+
+	TEST_ACTIONS_ARE_CORRECT(tree.get(), actions);
+}
+
+TEST_F(TestDFS, Range_FindFirst_StopsExpanding)
+{
+	std::size_t calls = 0;
+	const auto range = deamer::algorithm::tree::DFS::Range(tree.get(), [&](const Node* node) {
+		calls++;
+		return node->GetSubNodes();
+	});
+
+	const auto iter = std::find_if(range.begin(), range.end(), [](const auto& action) {
+		return action.first->GetData().a == 1021;
+	});
+
+	ASSERT_NE(range.end(), iter);
+	EXPECT_EQ(deamer::algorithm::tree::DFS::Action::Entry, (*iter).second);
+	EXPECT_EQ(3, calls);
+}
+
+TEST_F(TestDFS, Range_EmptyTree_IsEmpty)
+{
+	const auto range = deamer::algorithm::tree::DFS::Range((Node*)nullptr, &Node::GetSubNodes);
+
+	EXPECT_EQ(range.end(), range.begin());
+}
+
+TEST_F(TestDFS, StreamingExecute_SkipChildren_DoesNotExpandSubtree)
+{
+	using deamer::algorithm::tree::DFS;
+	std::size_t calls = 0;
+	std::vector<int> entries;
+	std::vector<int> exits;
+	DFS::Execute::Streaming::Search(
+		tree.get(),
+		[&](const Node* node) {
+			calls++;
+			return node->GetSubNodes();
+		},
+		[&](const Node* node) {
+			entries.push_back(node->GetData().a);
+			return node->GetData().a == 102 ? DFS::Control::SkipChildren : DFS::Control::Continue;
+		},
+		[&](const Node* node) { exits.push_back(node->GetData().a); });
+
+	EXPECT_EQ(4, calls);
+	EXPECT_EQ(std::vector<int>({10, 101, 102, 103, 1031}), entries);
+	EXPECT_EQ(std::vector<int>({101, 102, 1031, 103, 10}), exits);
+}
+
+TEST_F(TestDFS, StreamingExecute_Stop_EndsTraversal)
+{
+	using deamer::algorithm::tree::DFS;
+	std::vector<int> entries;
+	std::vector<int> exits;
+	DFS::Execute::Streaming::Search(
+		tree.get(), &Node::GetSubNodes,
+		[&](const Node* node) {
+			entries.push_back(node->GetData().a);
+			return node->GetData().a == 1021 ? DFS::Control::Stop : DFS::Control::Continue;
+		},
+		[&](const Node* node) { exits.push_back(node->GetData().a); });
+
+	EXPECT_EQ(std::vector<int>({10, 101, 102, 1021}), entries);
+	EXPECT_EQ(std::vector<int>({101}), exits);
+}
+
+TEST_F(TestDFS, ParallelExecute_SplitSubtrees_ComputesSubtreeSizes)
+{
+	using deamer::algorithm::tree::DFS;
+	auto root = std::make_unique<Node>(Data(0));
+	for (int i = 0; i < 8; i++)
+	{
+		auto subtree = std::make_unique<Node>(Data(i), root.get());
+		for (int j = 0; j < 100; j++)
+		{
+			auto subnode = std::make_unique<Node>(Data(j), subtree.get());
+			subnode->AddSubNode(std::make_unique<Node>(Data(j), subnode.get()));
+			subtree->AddSubNode(std::move(subnode));
+		}
+		root->AddSubNode(std::move(subtree));
+	}
+
+	// All nodes are inserted beforehand, tasks only modify the values of their own nodes.
+	std::map<const Node*, std::size_t> sizes;
+	for (const auto& [node, action] : DFS::Heap::Search(root.get(), &Node::GetSubNodes))
+	{
+		sizes[node] = 0;
+	}
+
+	std::atomic<std::size_t> entries = 0;
+	deamer::algorithm::thread::Pool pool(4);
+	deamer::algorithm::tree::ParallelDFS::Execute(
+		pool, root.get(), &Node::GetSubNodes,
+		[&](const Node* node) { return node->GetParent() == root.get(); },
+		[&](const Node* node) {
+			entries++;
+			EXPECT_EQ(0, sizes.find(node)->second);
+		},
+		[&](const Node* node) {
+			auto& size = sizes.find(node)->second;
+			size++;
+			// Split subnodes are merged into their parent instead.
+			if (node->GetParent() != nullptr && node->GetParent() != root.get())
+			{
+				sizes.find(node->GetParent())->second += size;
+			}
+		},
+		[&](const Node* node, const Node* splitSubnode) {
+			sizes.find(node)->second += sizes.find(splitSubnode)->second;
+		});
+
+	EXPECT_EQ(1 + 8 * 201, entries);
+	EXPECT_EQ(1 + 8 * 201, sizes[root.get()]);
+}
+
+TEST_F(TestDFS, HeapSearch_SinkExtension_CorrectlyCallInAndOutFunctions)
+{
+	const auto actions =
+		deamer::algorithm::tree::DFS::Heap::Search(tree.get(), &Node::VisitSubNodes);
+
+	TEST_ACTIONS_ARE_CORRECT(tree.get(), actions);
+	EXPECT_EQ(actions,
+			  deamer::algorithm::tree::DFS::Stack::Search(tree.get(), &Node::VisitSubNodes));
+}
+
+TEST_F(TestDFS, Sink_Copy_KeepsFunction)
+{
+	using deamer::algorithm::tree::Extension;
+	std::vector<const Node*> first;
+	std::vector<const Node*> second;
+	auto pushFirst = [&first](const Node* node) { first.push_back(node); };
+	auto pushSecond = [&second](const Node* node) { second.push_back(node); };
+
+	Extension::Sink<const Node> sink(pushFirst);
+	Extension::Sink<const Node> copy(sink);
+	sink = Extension::Sink<const Node>(pushSecond);
+	copy(tree.get());
+
+	EXPECT_EQ(first, std::vector<const Node*>{tree.get()});
+	EXPECT_TRUE(second.empty());
+}
+
+TEST_F(TestDFS, HeapSearch_IteratorPairAndReferenceExtension_CorrectlyCallInAndOutFunctions)
+{
+	std::map<const Node*, std::vector<const Node*>> subnodes;
+	for (const auto& [object, action] :
+		 deamer::algorithm::tree::DFS::Heap::Search(tree.get(), &Node::GetSubNodes))
+	{
+		subnodes[object] = object->GetSubNodes();
+	}
+
+	const auto pairActions = deamer::algorithm::tree::DFS::Heap::Search(
+		tree.get(), [&subnodes](const Node* node) {
+			const auto& range = subnodes.at(node);
+			return std::make_pair(range.begin(), range.end());
+		});
+	TEST_ACTIONS_ARE_CORRECT(tree.get(), pairActions);
+
+	const auto referenceActions = deamer::algorithm::tree::DFS::Heap::Search(
+		tree.get(), [&subnodes](const Node* node) -> const std::vector<const Node*>& {
+			return subnodes.at(node);
+		});
+	TEST_ACTIONS_ARE_CORRECT(tree.get(), referenceActions);
+}
+
+TEST_F(TestDFS, HeapSearch_MemoryResource_AllocatesOnlyFromResource)
+{
+	// The upstream resource throws, thus any allocation outside the buffer fails the test.
+	std::array<std::byte, 4096> buffer;
+	std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(),
+											  std::pmr::null_memory_resource());
+
+	const auto actions = deamer::algorithm::tree::DFS::Heap::Search(
+		std::allocator_arg, &arena, tree.get(), &Node::VisitSubNodes);
+	TEST_ACTIONS_ARE_CORRECT(tree.get(), {actions.begin(), actions.end()});
+
+	const auto parentActions = deamer::algorithm::tree::DFS::Heap::Search(
+		std::allocator_arg, std::pmr::polymorphic_allocator<std::byte>(&arena), tree.get(),
+		&Node::GetParent, &Node::VisitSubNodes);
+	EXPECT_TRUE(std::equal(actions.begin(), actions.end(), parentActions.begin(),
+						   parentActions.end()));
+
+	const auto stackActions = deamer::algorithm::tree::DFS::Stack::Search(
+		std::allocator_arg, &arena, tree.get(), &Node::VisitSubNodes);
+	EXPECT_TRUE(
+		std::equal(actions.begin(), actions.end(), stackActions.begin(), stackActions.end()));
+
+	std::size_t count = 0;
+	deamer::algorithm::tree::DFS::Execute::Search(
+		std::allocator_arg, &arena, tree.get(), &Node::VisitSubNodes,
+		[&](const Node*) { count++; }, [&](const Node*) { count++; });
+	EXPECT_EQ(count, actions.size());
+
+	std::vector<const Node*> entered;
+	deamer::algorithm::tree::DFS::Execute::Heap::Search(
+		std::allocator_arg, &arena, tree.get(), &Node::GetParent, &Node::VisitSubNodes,
+		[&](const Node* node) { entered.push_back(node); }, [](const Node*) {});
+	EXPECT_EQ(entered.size(), actions.size() / 2);
+	EXPECT_EQ(entered.front(), tree.get());
+}
+
+TEST_F(TestDFS, Context_RepeatedSearches_DoNotAllocate)
+{
+	// A monotonic resource never reuses memory, thus allocating on every search exhausts it.
+	std::array<std::byte, 4096> buffer;
+	std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(),
+											  std::pmr::null_memory_resource());
+	deamer::algorithm::tree::DFS::Context<const Node, std::pmr::memory_resource*> context(&arena);
+
+	for (auto i = 0; i < 1000; i++)
+	{
+		const auto& actions = context.Search(tree.get(), &Node::VisitSubNodes);
+		TEST_ACTIONS_ARE_CORRECT(tree.get(), {actions.begin(), actions.end()});
+
+		std::size_t count = 0;
+		context.Execute(
+			tree.get(), &Node::VisitSubNodes,
+			[&](const Node*) {
+				count++;
+				return deamer::algorithm::tree::DFS::Control::Stop;
+			},
+			[&](const Node*) { count++; });
+		EXPECT_EQ(count, 1);
+	}
+}
+
+TEST_F(TestDFS, HeapSearch_SizeHint_ReservesExactly)
+{
+	using deamer::algorithm::tree::SizeHint;
+
+	const auto counted = deamer::algorithm::tree::DFS::Heap::Search(
+		tree.get(), &Node::GetSubNodes, SizeHint::Count());
+	TEST_ACTIONS_ARE_CORRECT(tree.get(), counted);
+	EXPECT_EQ(counted.capacity(), 12);
+
+	const auto subtree = deamer::algorithm::tree::DFS::Heap::Search(
+		tree.get(), &Node::GetParent, &Node::GetSubNodes,
+		SizeHint::Subtree(tree.get(), [](const Node*) { return 6; }));
+	TEST_ACTIONS_ARE_CORRECT(tree.get(), subtree);
+	EXPECT_EQ(subtree.capacity(), 12);
+
+	// A hint that is too small only costs regrowth.
+	const auto estimated = deamer::algorithm::tree::DFS::Stack::Search(
+		tree.get(), &Node::GetSubNodes, SizeHint::Nodes(2));
+	TEST_ACTIONS_ARE_CORRECT(tree.get(), estimated);
+
+	const auto packed = deamer::algorithm::tree::DFS::Heap::SearchPacked(
+		tree.get(), &Node::GetSubNodes, SizeHint::Count());
+	EXPECT_TRUE(std::equal(counted.begin(), counted.end(), packed.begin(), packed.end()));
+	EXPECT_EQ(packed.capacity(), 12);
+}
+
+TEST_F(TestDFS, HeapSearchPacked_EqualsHeapSearch)
+{
+	const auto actions = deamer::algorithm::tree::DFS::Heap::Search(tree.get(), &Node::GetSubNodes);
+	const auto packed =
+		deamer::algorithm::tree::DFS::Heap::SearchPacked(tree.get(), &Node::GetSubNodes);
+
+	ASSERT_EQ(packed.size(), actions.size());
+	EXPECT_TRUE(std::equal(actions.begin(), actions.end(), packed.begin(), packed.end()));
+	for (std::size_t i = 0; i < actions.size(); i++)
+	{
+		EXPECT_EQ(packed[i], actions[i]);
+		EXPECT_EQ(packed.Object(i), actions[i].first);
+		EXPECT_EQ(packed.IsExit(i),
+				  actions[i].second == deamer::algorithm::tree::DFS::Action::Exit);
+	}
+}
+
+TEST_F(TestDFS, Replay_ReplaysWithoutSearching)
+{
+	const auto actions = deamer::algorithm::tree::DFS::Heap::Search(tree.get(), &Node::GetSubNodes);
+	const auto packed =
+		deamer::algorithm::tree::DFS::Heap::SearchPacked(tree.get(), &Node::GetSubNodes);
+
+	for (auto pass = 0; pass < 2; pass++)
+	{
+		std::vector<std::pair<const Node*, deamer::algorithm::tree::DFS::Action>> replayed;
+		deamer::algorithm::tree::DFS::Replay(
+			actions,
+			[&](const Node* node) {
+				replayed.emplace_back(node, deamer::algorithm::tree::DFS::Action::Entry);
+			},
+			[&](const Node* node) {
+				replayed.emplace_back(node, deamer::algorithm::tree::DFS::Action::Exit);
+			});
+		EXPECT_EQ(replayed, actions);
+	}
+
+	std::vector<int> entered;
+	std::vector<int> exited;
+	deamer::algorithm::tree::DFS::Replay(
+		packed,
+		[&](const Node* node) {
+			entered.push_back(node->GetData().a);
+			return node->GetData().a == 102 ? deamer::algorithm::tree::DFS::Control::SkipChildren
+											: deamer::algorithm::tree::DFS::Control::Continue;
+		},
+		[&](const Node* node) {
+			exited.push_back(node->GetData().a);
+			return node->GetData().a == 1031 ? deamer::algorithm::tree::DFS::Control::Stop
+											 : deamer::algorithm::tree::DFS::Control::Continue;
+		});
+	EXPECT_EQ(entered, (std::vector<int>{10, 101, 102, 103, 1031}));
+	EXPECT_EQ(exited, (std::vector<int>{101, 102, 1031}));
+}
+
+TEST_F(TestDFS, IncrementalUpdate_EqualsNewSearch)
+{
+	using deamer::algorithm::tree::DFS;
+	auto actions = DFS::Heap::Search(tree.get(), &Node::GetSubNodes);
+
+	auto tree_1_2 = tree->subNodes[1].get();
+	auto tree_1_3 = tree->subNodes[2].get();
+	auto tree_1_3_1 = tree_1_3->subNodes[0].get();
+	tree_1_2->AddSubNode(std::make_unique<Node>(Data(1022), tree_1_2));
+	auto removed = std::move(tree_1_3->subNodes.back());
+	tree_1_3->subNodes.pop_back();
+
+	// 1031 is within the modified subtree of 103, thus only 103 is searched again.
+	std::size_t expanded = 0;
+	DFS::Incremental::Update(actions, std::vector<const Node*>{tree_1_3_1, tree_1_2, tree_1_3},
+							 [&expanded](const Node* node) {
+								 expanded++;
+								 return node->GetSubNodes();
+							 });
+
+	EXPECT_EQ(actions, DFS::Heap::Search(tree.get(), &Node::GetSubNodes));
+	EXPECT_EQ(expanded, 4);
+}
+
+TEST_F(TestDFS, StackSearch_RecursionLimit_ContinuesOnHeap)
+{
+	using deamer::algorithm::tree::DFS;
+	const auto expected = DFS::Heap::Search(tree.get(), &Node::GetSubNodes);
+	for (std::size_t limit = 0; limit < 4; limit++)
+	{
+		EXPECT_EQ(expected, DFS::Stack::Search(tree.get(), &Node::GetSubNodes, limit));
+	}
+
+	// Deep enough to overflow the stack, if every level would recurse.
+	auto chain = std::make_unique<Node>(Data(0));
+	Node* last = chain.get();
+	for (int i = 1; i < 1000000; i++)
+	{
+		last->AddSubNode(new Node(Data(i), last));
+		last = last->subNodes.back().get();
+	}
+	EXPECT_EQ(DFS::Heap::Search(chain.get(), &Node::VisitSubNodes),
+			  DFS::Stack::Search(chain.get(), &Node::VisitSubNodes));
+
+	// Releases the chain iteratively, as its destructors would recurse.
+	while (!chain->subNodes.empty())
+	{
+		auto next = std::move(chain->subNodes.back());
+		chain->subNodes.clear();
+		chain = std::move(next);
+	}
+}
+
+TEST_F(TestDFS, HeapSearch_Prefetch_EqualsHeapSearch)
+{
+	using deamer::algorithm::tree::DFS;
+	using deamer::algorithm::tree::Prefetch;
+	const auto expected = DFS::Heap::Search(tree.get(), &Node::GetSubNodes);
+
+	for (std::size_t distance = 0; distance < 4; distance++)
+	{
+		EXPECT_EQ(expected,
+				  DFS::Heap::Search(tree.get(), &Node::GetSubNodes, Prefetch(distance)));
+		EXPECT_EQ(expected,
+				  DFS::Heap::Search(tree.get(), &Node::VisitSubNodes,
+									Prefetch(distance, [](const Node* node) {
+										return node->subNodes.data();
+									})));
+	}
+}
+
+TEST_F(TestDFS, Fold_CombinesSubtreesInOrder)
+{
+	using deamer::algorithm::tree::DFS;
+
+	const auto text = DFS::Fold(
+		tree.get(), &Node::GetSubNodes,
+		[](const Node* node) { return std::to_string(node->GetData().a); },
+		[](const Node* node, auto first, auto last) {
+			std::string value = std::to_string(node->GetData().a) + "(";
+			for (auto i = first; i != last; ++i)
+			{
+				value += (i == first ? "" : ",") + *i;
+			}
+			return value + ")";
+		});
+	ASSERT_TRUE(text.has_value());
+	EXPECT_EQ(*text, "10(101,102(1021),103(1031))");
+
+	const auto size = DFS::Fold(
+		tree.get(), &Node::VisitSubNodes, [](const Node*) { return std::size_t(1); },
+		[](const Node*, auto first, auto last) {
+			return std::accumulate(first, last, std::size_t(1));
+		});
+	EXPECT_EQ(*size, 6);
+
+	const Node* empty = nullptr;
+	EXPECT_FALSE(DFS::Fold(
+					 empty, &Node::GetSubNodes, [](const Node*) { return 1; },
+					 [](const Node*, auto, auto) { return 1; })
+					 .has_value());
+}
+
+TEST_F(TestDFS, FixedArity_SkipsEmptySlots)
+{
+	using deamer::algorithm::tree::DFS;
+	using deamer::algorithm::tree::Extension;
+
+	// 1 -> (2 -> (_, 4), 3)
+	BinaryNode node_1(1), node_2(2), node_3(3), node_4(4);
+	node_1.left = &node_2;
+	node_1.right = &node_3;
+	node_2.right = &node_4;
+	const BinaryNode* root = &node_1;
+
+	const auto expected = DFS::Heap::Search(root, &BinaryNode::GetSubNodeVector);
+	EXPECT_EQ(8, expected.size());
+	EXPECT_EQ(expected, DFS::Heap::Search(root, &BinaryNode::GetSubNodes));
+	EXPECT_EQ(expected, DFS::Heap::Search(root, Extension::Children()));
+	EXPECT_EQ(expected, DFS::Stack::Search(root, Extension::Children()));
+
+	std::vector<int> entered;
+	DFS::Execute::Heap::Search(
+		&node_1, Extension::Children(),
+		[&](const BinaryNode* node) { entered.push_back(node->data); }, [](const BinaryNode*) {});
+	EXPECT_EQ(entered, (std::vector<int>{1, 2, 4, 3}));
+}
+
 static void TEST_ACTIONS_ARE_CORRECT(
 	const Node* tree,
 	const std::vector<std::pair<const Node*, deamer::algorithm::tree::DFS::Action>>& actions)
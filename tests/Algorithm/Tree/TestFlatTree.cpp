@@ -0,0 +1,73 @@
+#include "Algorithm/Tree/TestTree.h"
+#include "Deamer/Algorithm/Tree/FlatTree.h"
+#include "Deamer/Algorithm/Tree/BFS.h"
+#include "Deamer/Algorithm/Tree/DFS.h"
+#include <vector>
+
+using deamer::algorithm::tests::Node;
+using TestFlatTree = deamer::algorithm::tests::TestTree;
+
+TEST_F(TestFlatTree, Build_CorrectlyStoreLayout)
+{
+	using deamer::algorithm::tree::FlatTree;
+	const auto flat = FlatTree<const Node>::Build(tree.get(), &Node::GetSubNodes);
+
+	ASSERT_EQ(7, flat.Size());
+	std::vector<int> data;
+	for (auto object : flat.Objects())
+	{
+		data.push_back(object->data);
+	}
+	EXPECT_EQ(std::vector<int>({10, 101, 102, 1021, 103, 1031, 1032}), data);
+
+	EXPECT_EQ(7, flat.SubtreeEnd(0));
+	EXPECT_EQ(4, flat.SubtreeEnd(2));
+	EXPECT_EQ(3, flat.SubtreeSize(4));
+	EXPECT_EQ(FlatTree<const Node>::npos, flat.Parent(0));
+	EXPECT_EQ(4, flat.Parent(6));
+	EXPECT_EQ(2, flat.Depth(5));
+	EXPECT_EQ(1, flat.FirstChild(0));
+	EXPECT_EQ(FlatTree<const Node>::npos, flat.FirstChild(1));
+	EXPECT_EQ(4, flat.NextSibling(2));
+	EXPECT_EQ(FlatTree<const Node>::npos, flat.NextSibling(4));
+
+	EXPECT_TRUE(flat.IsAncestor(0, 6));
+	EXPECT_TRUE(flat.IsAncestor(4, 4));
+	EXPECT_FALSE(flat.IsAncestor(2, 4));
+}
+
+TEST_F(TestFlatTree, Search_EqualsDFSSearch)
+{
+	const auto flat =
+		deamer::algorithm::tree::FlatTree<const Node>::Build(tree.get(), &Node::GetSubNodes);
+
+	EXPECT_EQ(deamer::algorithm::tree::DFS::Search(tree.get(), &Node::GetSubNodes),
+			  flat.Search());
+}
+
+TEST_F(TestFlatTree, BreadthFirstOrder_EqualsBFSOrder)
+{
+	const auto flat =
+		deamer::algorithm::tree::FlatTree<const Node>::Build(tree.get(), &Node::GetSubNodes);
+	const auto levels = deamer::algorithm::tree::BFS::Levels(static_cast<const Node*>(tree.get()),
+															 &Node::GetSubNodes);
+
+	std::vector<const Node*> objects;
+	for (auto index : flat.BreadthFirstOrder())
+	{
+		objects.push_back(flat[index]);
+	}
+
+	EXPECT_EQ(std::vector<const Node*>(levels.Entries().begin(), levels.Entries().end()),
+			  objects);
+}
+
+TEST_F(TestFlatTree, Build_EmptyTree_IsEmpty)
+{
+	const auto flat =
+		deamer::algorithm::tree::FlatTree<const Node>::Build(nullptr, &Node::GetSubNodes);
+
+	EXPECT_TRUE(flat.Empty());
+	EXPECT_TRUE(flat.Search().empty());
+	EXPECT_TRUE(flat.BreadthFirstOrder().empty());
+}
@@ -0,0 +1,99 @@
+#include "Algorithm/Tree/TestTree.h"
+#include "Deamer/Algorithm/Tree/Inplace.h"
+#include <string>
+#include <vector>
+
+using deamer::algorithm::tests::Node;
+
+namespace
+{
+	std::string Name(const Node* node)
+	{
+		return std::to_string(node->data);
+	}
+
+	std::string Join(const std::string& lhs, const std::string& rhs)
+	{
+		return lhs + "." + rhs;
+	}
+}
+
+class TestInplace : public deamer::algorithm::tests::TestTree
+{
+protected:
+	TestInplace()
+	{
+		// 1021 -> 102 -> 10
+		leaf = tree->subNodes[1]->subNodes[0].get();
+	}
+
+	virtual ~TestInplace() = default;
+
+protected:
+	const Node* leaf;
+};
+
+TEST_F(TestInplace, Fold_Direction_DecidesCombinedSide)
+{
+	using deamer::algorithm::tree::Inplace;
+
+	EXPECT_EQ(Inplace::Fold(leaf, &Node::GetParent, Name, Join), "1021.102.10");
+	EXPECT_EQ(Inplace::Fold<Inplace::Direction::Downward>(leaf, &Node::GetParent, Name, Join),
+			  "10.102.1021");
+	EXPECT_EQ(Inplace::Stack::Fold(leaf, &Node::GetParent, Name, Join), "1021.102.10");
+
+	const Node* empty = nullptr;
+	EXPECT_FALSE(Inplace::Fold(empty, &Node::GetParent, Name, Join).has_value());
+}
+
+TEST_F(TestInplace, Fold_Condition_StopsAtFailingNode)
+{
+	using deamer::algorithm::tree::Inplace;
+	const auto below102 = [](const Node* node) { return node->data != 102; };
+
+	EXPECT_EQ(Inplace::Fold(leaf, &Node::GetParent, Name, Join, below102), "1021.102");
+	EXPECT_EQ(Inplace::Stack::Fold(leaf, &Node::GetParent, Name, Join, below102), "1021.102");
+}
+
+TEST_F(TestInplace, BatchFold_VisitsEveryNodeOnce)
+{
+	using deamer::algorithm::tree::Inplace;
+	const Node* tree_1_3 = tree->subNodes[2].get();
+	const Node* tree_1_3_1 = tree_1_3->subNodes[0].get();
+	const Node* tree_1_3_2 = tree_1_3->subNodes[1].get();
+
+	std::size_t calls = 0;
+	const auto name = [&calls](const Node* node) {
+		calls++;
+		return Name(node);
+	};
+	const auto values = Inplace::Batch::Fold(
+		std::vector<const Node*>{tree_1_3_1, tree_1_3_2, tree_1_3, tree_1_3_1}, &Node::GetParent,
+		name, Join);
+
+	EXPECT_EQ(values, (std::vector<std::string>{"1031.103.10", "1032.103.10", "103.10",
+												 "1031.103.10"}));
+	EXPECT_EQ(4, calls);
+	for (auto node : {tree_1_3_1, tree_1_3_2, tree_1_3})
+	{
+		EXPECT_EQ(*Inplace::Stack::Fold(node, &Node::GetParent, Name, Join),
+				  Inplace::Batch::Fold(std::vector<const Node*>{node}, &Node::GetParent, Name,
+									   Join)[0]);
+	}
+
+	const auto below103 = [](const Node* node) { return node->data != 103; };
+	EXPECT_EQ(Inplace::Batch::Fold(std::vector<const Node*>{tree_1_3_1, tree_1_3_2},
+								   &Node::GetParent, Name, Join, below103),
+			  (std::vector<std::string>{"1031.103", "1032.103"}));
+}
+
+TEST_F(TestInplace, Construction_VisitsRequiredCalls)
+{
+	using deamer::algorithm::tree::Inplace;
+
+	std::vector<const Node*> visited;
+	Inplace::Execute::Heap::Construction(leaf, &Node::GetParent,
+										 [&](const Node* node) { visited.push_back(node); });
+	EXPECT_EQ(visited, Inplace::Heap::RequiredCalls(leaf, &Node::GetParent));
+	EXPECT_EQ(3, visited.size());
+}
@@ -0,0 +1,100 @@
+#include "Algorithm/Tree/TestTree.h"
+#include "Deamer/Algorithm/Tree/TraversalCache.h"
+#include <vector>
+
+using deamer::algorithm::tests::Node;
+
+class TestTraversalCache : public deamer::algorithm::tests::TestTree
+{
+protected:
+	virtual ~TestTraversalCache() = default;
+
+	// Extension function counting its calls.
+	auto CountingExtension()
+	{
+		return [this](const Node* node) {
+			calls++;
+			return node->GetSubNodes();
+		};
+	}
+
+protected:
+	std::size_t calls = 0;
+};
+
+TEST_F(TestTraversalCache, DepthFirst_SecondRequest_IsCached)
+{
+	using deamer::algorithm::tree::DFS;
+	deamer::algorithm::tree::TraversalCache<const Node> cache;
+
+	const auto& actions = cache.DepthFirst(tree.get(), CountingExtension());
+	EXPECT_EQ(actions, DFS::Heap::Search(tree.get(), &Node::GetSubNodes));
+	EXPECT_EQ(7, calls);
+
+	EXPECT_EQ(&actions, &cache.DepthFirst(tree.get(), CountingExtension()));
+	EXPECT_EQ(7, calls);
+
+	std::size_t executed = 0;
+	cache.Execute(
+		tree.get(), CountingExtension(), [&](const Node*) { executed++; },
+		[&](const Node*) { executed++; });
+	EXPECT_EQ(actions.size(), executed);
+	EXPECT_EQ(7, calls);
+}
+
+TEST_F(TestTraversalCache, BreadthFirst_EqualsSearch)
+{
+	using deamer::algorithm::tree::BFS;
+	deamer::algorithm::tree::TraversalCache<const Node> cache;
+
+	EXPECT_EQ(cache.BreadthFirst(tree.get(), &Node::GetSubNodes),
+			  BFS::Search<const Node>(tree.get(), &Node::GetSubNodes));
+	EXPECT_TRUE(cache.Contains(tree.get()));
+	EXPECT_EQ(1, cache.Size());
+}
+
+TEST_F(TestTraversalCache, Invalidate_RecomputesOrder)
+{
+	deamer::algorithm::tree::TraversalCache<const Node> cache;
+	cache.DepthFirst(tree.get(), CountingExtension());
+
+	tree->AddSubNode(104);
+	cache.Invalidate(tree.get());
+	EXPECT_FALSE(cache.Contains(tree.get()));
+
+	EXPECT_EQ(16, cache.DepthFirst(tree.get(), CountingExtension()).size());
+	EXPECT_EQ(15, calls);
+}
+
+TEST_F(TestTraversalCache, VersionFunction_ChangedVersion_RecomputesOrder)
+{
+	deamer::algorithm::tree::TraversalCache<const Node> cache(
+		[](const Node* root) { return root->version; });
+	cache.DepthFirst(tree.get(), CountingExtension());
+	cache.DepthFirst(tree.get(), CountingExtension());
+	EXPECT_EQ(7, calls);
+
+	tree->AddSubNode(104);
+	tree->version++;
+
+	EXPECT_EQ(16, cache.DepthFirst(tree.get(), CountingExtension()).size());
+	EXPECT_EQ(15, calls);
+}
+
+TEST_F(TestTraversalCache, Update_OnlyExpandsModifiedSubtrees)
+{
+	using deamer::algorithm::tree::DFS;
+	deamer::algorithm::tree::TraversalCache<const Node> cache(
+		[](const Node* root) { return root->version; });
+	cache.DepthFirst(tree.get(), CountingExtension());
+
+	auto tree_1_2 = tree->subNodes[1].get();
+	tree_1_2->AddSubNode(1022);
+	tree->version++;
+	cache.Update(tree.get(), std::vector<const Node*>{tree_1_2}, CountingExtension());
+
+	EXPECT_EQ(10, calls);
+	EXPECT_EQ(cache.DepthFirst(tree.get(), CountingExtension()),
+			  DFS::Heap::Search(tree.get(), &Node::GetSubNodes));
+	EXPECT_EQ(10, calls);
+}
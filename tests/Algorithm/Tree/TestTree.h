@@ -0,0 +1,67 @@
+#ifndef DEAMER_ALGORITHM_TESTS_TREE_TESTTREE_H
+#define DEAMER_ALGORITHM_TESTS_TREE_TESTTREE_H
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+namespace deamer::algorithm::tests
+{
+	// Node owning its subnodes, with a pointer to its parent.
+	struct Node
+	{
+		int data;
+		Node* parent;
+		// Incremented by tests modifying the subtree, for version functions.
+		std::size_t version = 0;
+		std::vector<std::unique_ptr<Node>> subNodes;
+
+		Node(int data_, Node* parent_ = nullptr) : data(data_), parent(parent_)
+		{
+		}
+
+		Node* AddSubNode(int data_)
+		{
+			subNodes.push_back(std::make_unique<Node>(data_, this));
+			return subNodes.back().get();
+		}
+
+		const Node* GetParent() const
+		{
+			return parent;
+		}
+
+		std::vector<const Node*> GetSubNodes() const
+		{
+			std::vector<const Node*> subnodes;
+			for (const auto& subnode : subNodes)
+			{
+				subnodes.push_back(subnode.get());
+			}
+			return subnodes;
+		}
+	};
+
+	// Fixture providing the tree 10 -> (101, 102 -> (1021), 103 -> (1031, 1032)).
+	class TestTree : public testing::Test
+	{
+	protected:
+		TestTree()
+		{
+			tree = std::make_unique<Node>(10);
+			tree->AddSubNode(101);
+			tree->AddSubNode(102)->AddSubNode(1021);
+			auto tree_1_3 = tree->AddSubNode(103);
+			tree_1_3->AddSubNode(1031);
+			tree_1_3->AddSubNode(1032);
+		}
+
+		virtual ~TestTree() = default;
+
+	protected:
+		std::unique_ptr<Node> tree;
+	};
+}
+
+#endif // DEAMER_ALGORITHM_TESTS_TREE_TESTTREE_H
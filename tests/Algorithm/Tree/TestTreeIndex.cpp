@@ -0,0 +1,98 @@
+#include "Algorithm/Tree/TestTree.h"
+#include "Deamer/Algorithm/Tree/TreeIndex.h"
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+using deamer::algorithm::tests::Node;
+
+namespace
+{
+	std::vector<const Node*> Ancestors(const Node* node)
+	{
+		std::vector<const Node*> ancestors;
+		for (; node != nullptr; node = node->parent)
+		{
+			ancestors.push_back(node);
+		}
+		return ancestors;
+	}
+}
+
+class TestTreeIndex : public deamer::algorithm::tests::TestTree
+{
+protected:
+	TestTreeIndex()
+	{
+		// Every node i > 0 is attached to node (i * 7 + 3) % i, giving uneven depths and fan-outs.
+		uneven = std::make_unique<Node>(0);
+		nodes.push_back(uneven.get());
+		for (int i = 1; i < 60; i++)
+		{
+			nodes.push_back(nodes[(i * 7 + 3) % i]->AddSubNode(i));
+		}
+	}
+
+	virtual ~TestTreeIndex() = default;
+
+protected:
+	std::unique_ptr<Node> uneven;
+	std::vector<Node*> nodes;
+};
+
+TEST_F(TestTreeIndex, Queries_EqualWalkingAncestors)
+{
+	const auto index =
+		deamer::algorithm::tree::TreeIndex<const Node>::Build(uneven.get(), &Node::GetSubNodes);
+	ASSERT_EQ(nodes.size(), index.Tree().Size());
+
+	for (const Node* lhs : nodes)
+	{
+		const auto lhsAncestors = Ancestors(lhs);
+		EXPECT_EQ(lhsAncestors.size() - 1, index.DepthOf(lhs));
+		for (std::size_t k = 0; k <= lhsAncestors.size(); k++)
+		{
+			EXPECT_EQ(k < lhsAncestors.size() ? lhsAncestors[k] : nullptr,
+					  index.AncestorOf(lhs, k));
+		}
+
+		for (const Node* rhs : nodes)
+		{
+			const auto rhsAncestors = Ancestors(rhs);
+			EXPECT_EQ(std::find(rhsAncestors.begin(), rhsAncestors.end(), lhs) !=
+						  rhsAncestors.end(),
+					  index.IsAncestorOf(lhs, rhs));
+
+			const Node* expected = nullptr;
+			for (auto ancestor : lhsAncestors)
+			{
+				if (std::find(rhsAncestors.begin(), rhsAncestors.end(), ancestor) !=
+					rhsAncestors.end())
+				{
+					expected = ancestor;
+					break;
+				}
+			}
+			EXPECT_EQ(expected, index.LowestCommonAncestorOf(lhs, rhs));
+		}
+	}
+}
+
+TEST_F(TestTreeIndex, Index_UnknownObject_IsNpos)
+{
+	using deamer::algorithm::tree::TreeIndex;
+	const auto index = TreeIndex<const Node>::Build(tree->subNodes[0].get(), &Node::GetSubNodes);
+	EXPECT_EQ(TreeIndex<const Node>::npos, index.Index(tree.get()));
+	EXPECT_EQ(0, index.Index(tree->subNodes[0].get()));
+	EXPECT_EQ(0, index.Depth(0));
+	EXPECT_EQ(0, index.Ancestor(0, 0));
+
+	EXPECT_EQ(TreeIndex<const Node>::npos, index.DepthOf(tree.get()));
+	EXPECT_FALSE(index.IsAncestorOf(tree.get(), tree->subNodes[0].get()));
+	EXPECT_FALSE(index.IsAncestorOf(tree->subNodes[0].get(), tree.get()));
+	EXPECT_EQ(nullptr, index.LowestCommonAncestorOf(tree.get(), tree->subNodes[0].get()));
+	EXPECT_EQ(nullptr, index.AncestorOf(tree.get(), 0));
+
+	const auto empty = TreeIndex<const Node>::Build(nullptr, &Node::GetSubNodes);
+	EXPECT_EQ(0, empty.Tree().Size());
+}